@@ -0,0 +1,140 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+namespace
+{
+	constexpr int columnWidth = 16;
+}
+
+std::vector<Benchmark::Case>& Benchmark::getCases()
+{
+	static std::vector<Case> cases;
+	return cases;
+}
+
+Benchmark::Registration::Registration(const std::string& name, const std::string& description, std::function<void()> run)
+{
+	getCases().push_back({ name, description, std::move(run) });
+}
+
+void Benchmark::setEnvironmentVariable(const std::string& name, const std::string& value)
+{
+#if JUCE_WINDOWS
+	_putenv_s(name.c_str(), value.c_str());
+#else
+	setenv(name.c_str(), value.c_str(), 1);
+#endif
+}
+
+void Benchmark::clearEnvironmentVariable(const std::string& name)
+{
+#if JUCE_WINDOWS
+	_putenv_s(name.c_str(), "");
+#else
+	unsetenv(name.c_str());
+#endif
+}
+
+std::unique_ptr<PluginAudioProcessor> Benchmark::createLoadedProcessor(const double sampleRate, const int blockSize)
+{
+	auto processor = std::make_unique<PluginAudioProcessor>();
+
+	while (processor->isLoadingSamples())
+	{
+		juce::Thread::sleep(1);
+	}
+
+	processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+	processor->prepareToPlay(sampleRate, blockSize);
+
+	return processor;
+}
+
+juce::MidiBuffer Benchmark::makeHits(const std::vector<int>& midiNotes, const juce::int64 blockStart, const int blockSize, const int intervalSamples, const float velocity)
+{
+	juce::MidiBuffer midiBuffer;
+
+	if (midiNotes.empty() || intervalSamples <= 0)
+	{
+		return midiBuffer;
+	}
+
+	juce::int64 hitIndex = (blockStart + intervalSamples - 1) / intervalSamples;
+
+	for (juce::int64 hitPosition = hitIndex * intervalSamples; hitPosition < blockStart + blockSize; hitPosition += intervalSamples, hitIndex++)
+	{
+		const int midiNote = midiNotes[(size_t)(hitIndex % (juce::int64)midiNotes.size())];
+		midiBuffer.addEvent(juce::MidiMessage::noteOn(10, midiNote, velocity), (int)(hitPosition - blockStart));
+	}
+
+	return midiBuffer;
+}
+
+std::vector<double> Benchmark::renderBlocks(PluginAudioProcessor& processor, const int blockSize, const int numberOfBlocks, const std::vector<int>& midiNotes, const int intervalSamples)
+{
+	juce::AudioBuffer<float> buffer(processor.getTotalNumOutputChannels(), blockSize);
+	std::vector<double> blockMilliseconds;
+	blockMilliseconds.reserve((size_t)numberOfBlocks);
+
+	for (int blockIndex = 0; blockIndex < numberOfBlocks; blockIndex++)
+	{
+		auto midiBuffer = makeHits(midiNotes, (juce::int64)blockIndex * blockSize, blockSize, intervalSamples);
+		buffer.clear();
+
+		const double startMilliseconds = getMilliseconds();
+		processor.processBlock(buffer, midiBuffer);
+		blockMilliseconds.push_back(getMilliseconds() - startMilliseconds);
+	}
+
+	return blockMilliseconds;
+}
+
+double Benchmark::getMilliseconds()
+{
+	return juce::Time::getMillisecondCounterHiRes();
+}
+
+double Benchmark::percentile(std::vector<double> values, const double fraction)
+{
+	if (values.empty())
+	{
+		return 0.0;
+	}
+
+	std::sort(values.begin(), values.end());
+	const auto index = (size_t)juce::jlimit(0, (int)values.size() - 1, (int)std::ceil(fraction * (double)values.size()) - 1);
+	return values[index];
+}
+
+double Benchmark::mean(const std::vector<double>& values)
+{
+	return values.empty() ? 0.0 : std::accumulate(values.begin(), values.end(), 0.0) / (double)values.size();
+}
+
+void Benchmark::printHeader(const std::vector<std::string>& columns)
+{
+	printRow(columns);
+	std::cout << std::string(columns.size() * columnWidth, '-') << std::endl;
+}
+
+void Benchmark::printRow(const std::vector<std::string>& cells)
+{
+	for (const auto& cell : cells)
+	{
+		std::cout << std::left << std::setw(columnWidth) << cell;
+	}
+
+	std::cout << std::endl;
+}
+
+std::string Benchmark::format(const double value, const int decimalPlaces)
+{
+	std::ostringstream stream;
+	stream << std::fixed << std::setprecision(decimalPlaces) << value;
+	return stream.str();
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <JuceHeader.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../Source/PluginAudioProcessor.h"
+
+/*
+	Shared pieces of the benchmark cases. Each case lives in its own file and registers
+	itself with a static Benchmark::Registration, Main runs them by name.
+*/
+namespace Benchmark
+{
+	struct Case {
+		std::string name;
+		std::string description;
+		std::function<void()> run;
+	};
+
+	std::vector<Case>& getCases();
+
+	struct Registration {
+		Registration(const std::string& name, const std::string& description, std::function<void()> run);
+	};
+
+	// Processor settings come from the environment (see Configuration/Samples.h), so cases set
+	// them before constructing a processor and clear them again afterwards.
+	void setEnvironmentVariable(const std::string& name, const std::string& value);
+	void clearEnvironmentVariable(const std::string& name);
+
+	// A processor with every sample loaded and prepared for playback.
+	std::unique_ptr<PluginAudioProcessor> createLoadedProcessor(double sampleRate, int blockSize);
+
+	// Hits cycling through midiNotes every intervalSamples, from the absolute sample position blockStart on.
+	juce::MidiBuffer makeHits(const std::vector<int>& midiNotes, juce::int64 blockStart, int blockSize, int intervalSamples, float velocity = 0.8f);
+
+	// Wall clock milliseconds of each of numberOfBlocks processBlock calls playing the hits.
+	std::vector<double> renderBlocks(PluginAudioProcessor& processor, int blockSize, int numberOfBlocks, const std::vector<int>& midiNotes, int intervalSamples);
+
+	double getMilliseconds();
+	double percentile(std::vector<double> values, double fraction);
+	double mean(const std::vector<double>& values);
+
+	void printHeader(const std::vector<std::string>& columns);
+	void printRow(const std::vector<std::string>& cells);
+	std::string format(double value, int decimalPlaces = 3);
+}
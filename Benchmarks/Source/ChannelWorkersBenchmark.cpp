@@ -0,0 +1,52 @@
+#include "Benchmark.h"
+#include <iostream>
+#include "../../Source/Configuration/Channels.h"
+
+// Wall clock time per block with the drum channel strips processed serially and spread over
+// one to eight channel workers, from small to large host blocks. One processor stays alive
+// throughout so the others attach to its samples rather than decoding them again.
+namespace
+{
+	constexpr double sampleRate = 44100.0;
+	constexpr double renderSeconds = 10.0;
+	constexpr int intervalSamples = 2756; // 32nd notes at 120 BPM
+	constexpr int maximumNumberOfWorkers = 8;
+
+	void run()
+	{
+		const auto sampleOwner = Benchmark::createLoadedProcessor(sampleRate, 512);
+		const auto midiNotes = sampleOwner->getMidiNotesVector();
+
+		std::vector<std::string> columns = { "block", "serial" };
+
+		for (int numberOfWorkers = 1; numberOfWorkers <= maximumNumberOfWorkers; numberOfWorkers++)
+		{
+			columns.push_back(std::to_string(numberOfWorkers));
+		}
+
+		std::cout << "mean (p99) microseconds per block by number of workers" << std::endl;
+		Benchmark::printHeader(columns);
+
+		for (int blockSize = 32; blockSize <= 2048; blockSize *= 2)
+		{
+			std::vector<std::string> cells = { std::to_string(blockSize) };
+			const int numberOfBlocks = (int)(renderSeconds * sampleRate) / blockSize;
+
+			for (int numberOfWorkers = 0; numberOfWorkers <= maximumNumberOfWorkers; numberOfWorkers++)
+			{
+				Benchmark::setEnvironmentVariable(Channels::workersEnvironmentVariable, std::to_string(numberOfWorkers));
+				auto processor = Benchmark::createLoadedProcessor(sampleRate, blockSize);
+				const auto blockTimes = Benchmark::renderBlocks(*processor, blockSize, numberOfBlocks, midiNotes, intervalSamples);
+
+				cells.push_back(Benchmark::format(1000.0 * Benchmark::mean(blockTimes), 0)
+					+ " (" + Benchmark::format(1000.0 * Benchmark::percentile(blockTimes, 0.99), 0) + ")");
+			}
+
+			Benchmark::printRow(cells);
+		}
+
+		Benchmark::clearEnvironmentVariable(Channels::workersEnvironmentVariable);
+	}
+
+	Benchmark::Registration registration("workers", "time per block by block size and number of channel workers", run);
+}
@@ -0,0 +1,136 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <iostream>
+#include "../../Source/Configuration/SampleManifest.h"
+#include "../../Source/Synthesiser/PluginCompressedChannel.h"
+
+// Compression ratio of the lossless format over the embedded kit, and what decoding it costs a
+// voice reading the way fetchFrames does: chunks a couple of frames longer than they advance,
+// starting off the block grid.
+namespace
+{
+	constexpr double sampleRate = 44100.0;
+	constexpr int chunkAdvance = 256;
+	constexpr int chunkLength = chunkAdvance + 2;
+	constexpr int chunkOffset = 37;
+	constexpr int numberOfPasses = 4;
+
+	struct Channel {
+		std::unique_ptr<PluginCompressedChannel> compressedChannel;
+		int numberOfFrames;
+	};
+
+	std::vector<Channel> loadChannels()
+	{
+		juce::AudioFormatManager audioFormatManager;
+		audioFormatManager.registerBasicFormats();
+
+		std::vector<Channel> channels;
+
+		for (const auto& manifestEntry : SampleManifest::entries)
+		{
+			auto memoryInputStream = std::make_unique<juce::MemoryInputStream>(*manifestEntry.data, (size_t)manifestEntry.dataSize, false);
+			std::unique_ptr<juce::AudioFormatReader> reader(audioFormatManager.createReaderFor(std::move(memoryInputStream)));
+
+			if (reader == nullptr)
+			{
+				DBG("unreadable sample " + juce::String(manifestEntry.resourceName));
+				continue;
+			}
+
+			const int length = (int)reader->lengthInSamples;
+			juce::AudioBuffer<float> buffer((int)reader->numChannels, length);
+			reader->read(&buffer, 0, length, 0, true, true);
+
+			for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+			{
+				channels.push_back({ std::make_unique<PluginCompressedChannel>(buffer.getReadPointer(channel), length), length });
+			}
+		}
+
+		return channels;
+	}
+
+	// Milliseconds to read every channel once in voice sized chunks, with or without a cursor
+	// carrying the last decoded block from one chunk to the next.
+	double readAll(const std::vector<Channel>& channels, const bool isUsingCursor, float& checksum)
+	{
+		float destination[chunkLength];
+		PluginCompressedChannel::Cursor cursor;
+		const double startTime = Benchmark::getMilliseconds();
+
+		for (const auto& channelEntry : channels)
+		{
+			const auto& channel = *channelEntry.compressedChannel;
+
+			for (int startFrame = chunkOffset; startFrame + chunkLength <= channelEntry.numberOfFrames; startFrame += chunkAdvance)
+			{
+				if (isUsingCursor)
+				{
+					channel.readFrames(startFrame, chunkLength, destination, cursor);
+				}
+				else
+				{
+					channel.readFrames(startFrame, chunkLength, destination);
+				}
+
+				checksum += destination[0];
+			}
+		}
+
+		return Benchmark::getMilliseconds() - startTime;
+	}
+
+	void run()
+	{
+		const auto channels = loadChannels();
+		juce::int64 numberOfFrames = 0;
+		size_t memorySize = 0;
+
+		for (const auto& channel : channels)
+		{
+			numberOfFrames += channel.numberOfFrames;
+			memorySize += channel.compressedChannel->getMemorySize();
+		}
+
+		if (numberOfFrames == 0)
+		{
+			std::cout << "no samples decoded" << std::endl;
+			return;
+		}
+
+		Benchmark::printHeader({ "frames", "lossless MB", "vs float32", "vs int24" });
+		Benchmark::printRow({
+			std::to_string(numberOfFrames),
+			Benchmark::format((double)memorySize / (1024.0 * 1024.0), 1),
+			Benchmark::format((double)memorySize / ((double)numberOfFrames * sizeof(float)), 3),
+			Benchmark::format((double)memorySize / ((double)numberOfFrames * 3.0), 3) });
+		std::cout << std::endl;
+
+		float checksum = 0.0f;
+		Benchmark::printHeader({ "reads", "ns per frame", "% core/voice" });
+
+		for (const bool isUsingCursor : { false, true })
+		{
+			std::vector<double> passTimes;
+
+			for (int pass = 0; pass < numberOfPasses; pass++)
+			{
+				passTimes.push_back(readAll(channels, isUsingCursor, checksum));
+			}
+
+			// Best pass, per frame read; a stereo voice reads two channels for every output frame.
+			const double nanosecondsPerFrame = 1.0e6 * *std::min_element(passTimes.begin(), passTimes.end()) / (double)numberOfFrames;
+			const double voiceLoad = 2.0 * nanosecondsPerFrame * sampleRate / 1.0e9;
+
+			Benchmark::printRow({
+				isUsingCursor ? "cursor" : "per chunk",
+				Benchmark::format(nanosecondsPerFrame, 2),
+				Benchmark::format(100.0 * voiceLoad, 3) });
+		}
+
+		std::cout << "checksum " << checksum << std::endl;
+	}
+
+	Benchmark::Registration registration("lossless", "lossless sample compression ratio and decode cost per voice", run);
+}
@@ -0,0 +1,146 @@
+#include "Benchmark.h"
+#include <cmath>
+#include <iostream>
+#include "../../Source/PluginEqualizerBank.h"
+#include "../../Source/Configuration/Channels.h"
+
+// The fused equalizer bank against what it replaced, three chained
+// ProcessorDuplicator<IIR::Filter> per strip, over every strip of a block: time per block and
+// the largest difference between their outputs.
+namespace
+{
+	using Filter = juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>>;
+
+	constexpr double sampleRate = 44100.0;
+	constexpr int numberOfChannels = 2;
+	constexpr double renderSeconds = 20.0;
+
+	struct StripFilters {
+		Filter lowShelf;
+		Filter peakFilter;
+		Filter highShelf;
+	};
+
+	// Distinct settings per strip so no two strips run the same filters.
+	std::array<juce::dsp::IIR::Coefficients<float>::Ptr, PluginEqualizerBank::numberOfBands> makeCoefficients(const int stripIndex)
+	{
+		const float offset = (float)stripIndex / (float)Channels::size;
+
+		return {
+			juce::dsp::IIR::Coefficients<float>::makeLowShelf(sampleRate, 80.0f + 120.0f * offset, 0.7f, juce::Decibels::decibelsToGain(4.0f - 8.0f * offset)),
+			juce::dsp::IIR::Coefficients<float>::makePeakFilter(sampleRate, 500.0f + 2000.0f * offset, 1.2f, juce::Decibels::decibelsToGain(-6.0f + 10.0f * offset)),
+			juce::dsp::IIR::Coefficients<float>::makeHighShelf(sampleRate, 4000.0f + 6000.0f * offset, 0.7f, juce::Decibels::decibelsToGain(3.0f - 6.0f * offset)) };
+	}
+
+	void fillNoise(juce::AudioBuffer<float>& buffer, juce::Random& random)
+	{
+		for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+		{
+			for (int frame = 0; frame < buffer.getNumSamples(); frame++)
+			{
+				buffer.setSample(channel, frame, random.nextFloat() * 2.0f - 1.0f);
+			}
+		}
+	}
+
+	void run()
+	{
+		Benchmark::printHeader({ "block", "bank us", "filters us", "speedup", "max error" });
+
+		for (const int blockSize : { 32, 256, 2048 })
+		{
+			juce::dsp::ProcessSpec spec;
+			spec.sampleRate = sampleRate;
+			spec.maximumBlockSize = (juce::uint32)blockSize;
+			spec.numChannels = numberOfChannels;
+
+			PluginEqualizerBank equalizerBank;
+			equalizerBank.prepare(Channels::size, numberOfChannels);
+			std::vector<std::unique_ptr<StripFilters>> stripFilters;
+
+			for (int stripIndex = 0; stripIndex < Channels::size; stripIndex++)
+			{
+				const auto coefficients = makeCoefficients(stripIndex);
+				equalizerBank.setCoefficients(stripIndex, PluginEqualizerBank::lowShelf, *coefficients[PluginEqualizerBank::lowShelf]);
+				equalizerBank.setCoefficients(stripIndex, PluginEqualizerBank::peakFilter, *coefficients[PluginEqualizerBank::peakFilter]);
+				equalizerBank.setCoefficients(stripIndex, PluginEqualizerBank::highShelf, *coefficients[PluginEqualizerBank::highShelf]);
+
+				stripFilters.push_back(std::make_unique<StripFilters>());
+				auto& filters = *stripFilters.back();
+				*filters.lowShelf.state = *coefficients[PluginEqualizerBank::lowShelf];
+				*filters.peakFilter.state = *coefficients[PluginEqualizerBank::peakFilter];
+				*filters.highShelf.state = *coefficients[PluginEqualizerBank::highShelf];
+				filters.lowShelf.prepare(spec);
+				filters.peakFilter.prepare(spec);
+				filters.highShelf.prepare(spec);
+			}
+
+			std::vector<juce::AudioBuffer<float>> bankBuffers((size_t)Channels::size, juce::AudioBuffer<float>(numberOfChannels, blockSize));
+			std::vector<juce::AudioBuffer<float>> filterBuffers = bankBuffers;
+			std::vector<double> bankTimes;
+			std::vector<double> filterTimes;
+			juce::Random random(1);
+			float maximumError = 0.0f;
+
+			const int numberOfBlocks = (int)(renderSeconds * sampleRate) / blockSize;
+
+			for (int blockIndex = 0; blockIndex < numberOfBlocks; blockIndex++)
+			{
+				for (int stripIndex = 0; stripIndex < Channels::size; stripIndex++)
+				{
+					fillNoise(bankBuffers[(size_t)stripIndex], random);
+					filterBuffers[(size_t)stripIndex].makeCopyOf(bankBuffers[(size_t)stripIndex], true);
+				}
+
+				double startTime = Benchmark::getMilliseconds();
+
+				for (int stripIndex = 0; stripIndex < Channels::size; stripIndex++)
+				{
+					juce::dsp::AudioBlock<float> block(bankBuffers[(size_t)stripIndex]);
+					equalizerBank.process(stripIndex, block);
+				}
+
+				bankTimes.push_back(Benchmark::getMilliseconds() - startTime);
+				startTime = Benchmark::getMilliseconds();
+
+				for (int stripIndex = 0; stripIndex < Channels::size; stripIndex++)
+				{
+					juce::dsp::AudioBlock<float> block(filterBuffers[(size_t)stripIndex]);
+					juce::dsp::ProcessContextReplacing<float> context(block);
+					auto& filters = *stripFilters[(size_t)stripIndex];
+					filters.lowShelf.process(context);
+					filters.peakFilter.process(context);
+					filters.highShelf.process(context);
+				}
+
+				filterTimes.push_back(Benchmark::getMilliseconds() - startTime);
+
+				for (int stripIndex = 0; stripIndex < Channels::size; stripIndex++)
+				{
+					for (int channel = 0; channel < numberOfChannels; channel++)
+					{
+						const float* bankSamples = bankBuffers[(size_t)stripIndex].getReadPointer(channel);
+						const float* filterSamples = filterBuffers[(size_t)stripIndex].getReadPointer(channel);
+
+						for (int frame = 0; frame < blockSize; frame++)
+						{
+							maximumError = juce::jmax(maximumError, std::abs(bankSamples[frame] - filterSamples[frame]));
+						}
+					}
+				}
+			}
+
+			const double bankTime = Benchmark::mean(bankTimes);
+			const double filterTime = Benchmark::mean(filterTimes);
+
+			Benchmark::printRow({
+				std::to_string(blockSize),
+				Benchmark::format(1000.0 * bankTime, 2),
+				Benchmark::format(1000.0 * filterTime, 2),
+				Benchmark::format(filterTime / bankTime, 2),
+				Benchmark::format(maximumError, 9) });
+		}
+	}
+
+	Benchmark::Registration registration("equalizer", "fused equalizer bank against three chained IIR filters per strip", run);
+}
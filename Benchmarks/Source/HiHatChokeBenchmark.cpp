@@ -0,0 +1,46 @@
+#include "Benchmark.h"
+#include "../../Source/Configuration/GeneralMidi.h"
+
+// Render cost of a dense hi-hat figure where nearly every hit chokes the one before: open hats
+// cut by the closed hat and the pedal, at 32nd notes from a moderate to an extreme tempo.
+namespace
+{
+	constexpr double sampleRate = 44100.0;
+	constexpr int blockSize = 256;
+	constexpr int numberOfBlocks = 4000; // about 23 seconds of audio
+
+	void run()
+	{
+		const std::vector<int> pattern = {
+			GeneralMidiPercussion::openHiHatNote,
+			GeneralMidiPercussion::closedHiHatNote,
+			GeneralMidiPercussion::openHiHatNote,
+			GeneralMidiPercussion::pedalHiHatNote,
+			GeneralMidiPercussion::closedHiHatNote,
+			GeneralMidiPercussion::openHiHatNote,
+			GeneralMidiPercussion::pedalHiHatNote,
+			GeneralMidiPercussion::closedHiHatNote
+		};
+
+		const double blockMilliseconds = 1000.0 * blockSize / sampleRate;
+		auto processor = Benchmark::createLoadedProcessor(sampleRate, blockSize);
+
+		Benchmark::printHeader({ "tempo BPM", "hits/second", "mean ms", "p99 ms", "% of block" });
+
+		for (const int tempo : { 120, 180, 240, 320 })
+		{
+			// Eight 32nd notes per beat.
+			const int intervalSamples = juce::roundToInt(sampleRate * 60.0 / (tempo * 8.0));
+			const auto blockTimes = Benchmark::renderBlocks(*processor, blockSize, numberOfBlocks, pattern, intervalSamples);
+
+			Benchmark::printRow({
+				std::to_string(tempo),
+				Benchmark::format(sampleRate / intervalSamples, 1),
+				Benchmark::format(Benchmark::mean(blockTimes)),
+				Benchmark::format(Benchmark::percentile(blockTimes, 0.99)),
+				Benchmark::format(100.0 * Benchmark::mean(blockTimes) / blockMilliseconds, 1) });
+		}
+	}
+
+	Benchmark::Registration registration("hihat", "dense 32nd note hi-hat choke pattern", run);
+}
@@ -0,0 +1,51 @@
+#include <JuceHeader.h>
+#include <iostream>
+#include "Benchmark.h"
+
+/*
+	Pro Punk Drums Benchmarks [case ...]
+
+	Runs the named cases, or every case when none is given. Cases that build processors
+	need the same embedded samples as the plugin, so this project carries its resources.
+*/
+int main(int argc, char* argv[])
+{
+	juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+	juce::StringArray caseNames;
+
+	for (int argumentIndex = 1; argumentIndex < argc; argumentIndex++)
+	{
+		caseNames.add(argv[argumentIndex]);
+	}
+
+	if (caseNames.contains("--list"))
+	{
+		for (const auto& benchmarkCase : Benchmark::getCases())
+		{
+			std::cout << benchmarkCase.name << "\t" << benchmarkCase.description << std::endl;
+		}
+
+		return 0;
+	}
+
+	int numberOfCasesRun = 0;
+
+	for (const auto& benchmarkCase : Benchmark::getCases())
+	{
+		if (caseNames.isEmpty() || caseNames.contains(benchmarkCase.name))
+		{
+			std::cout << std::endl << "== " << benchmarkCase.name << ": " << benchmarkCase.description << std::endl << std::endl;
+			benchmarkCase.run();
+			numberOfCasesRun++;
+		}
+	}
+
+	if (numberOfCasesRun == 0)
+	{
+		std::cerr << "no benchmark matches, see --list" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,247 @@
+#include "Benchmark.h"
+#include <cmath>
+#include <iostream>
+#include "../../Source/PluginFdnReverb.h"
+#include "../../Source/PluginRoomConvolution.h"
+#include "../../Source/Configuration/Parameters.h"
+
+// The feedback delay network room against juce::dsp::Reverb, both rendering the same length of
+// output from the same input with the processor's room parameters: cost per block, and the wet
+// level of each as the energy of its impulse response. Then a long room impulse response
+// convolved entirely on the audio thread against PluginRoomConvolution, which leaves all but
+// its head to a background thread, at several block sizes.
+namespace
+{
+	constexpr double sampleRate = 44100.0;
+	constexpr int blockSize = 256;
+	constexpr double renderSeconds = 30.0;
+	constexpr double impulseResponseSeconds = 12.0;
+	constexpr double roomResponseSeconds = 2.5;
+	constexpr int loadTimeoutMilliseconds = 10000;
+
+	juce::dsp::Reverb::Parameters getParameters()
+	{
+		return {
+			AudioParameters::roomSizeDefaultValue,
+			AudioParameters::dampingDefaultValue,
+			1.0f,
+			0.0f,
+			AudioParameters::widthDefaultValue,
+			0.0f };
+	}
+
+	template <typename Reverb>
+	std::vector<double> renderBlocks(Reverb& reverb, const int numberOfBlocks, const int blockLength = blockSize)
+	{
+		juce::AudioBuffer<float> buffer(2, blockLength);
+		juce::Random random(1);
+		std::vector<double> blockTimes;
+
+		for (int blockIndex = 0; blockIndex < numberOfBlocks; blockIndex++)
+		{
+			// A short noise burst every eighth block, silence in between, like sparse hits.
+			buffer.clear();
+
+			if (blockIndex % 8 == 0)
+			{
+				for (int channel = 0; channel < 2; channel++)
+				{
+					for (int frame = 0; frame < blockLength; frame++)
+					{
+						buffer.setSample(channel, frame, random.nextFloat() * 2.0f - 1.0f);
+					}
+				}
+			}
+
+			juce::dsp::AudioBlock<float> block(buffer);
+			const double startTime = Benchmark::getMilliseconds();
+			reverb.process(juce::dsp::ProcessContextReplacing<float>(block));
+			blockTimes.push_back(Benchmark::getMilliseconds() - startTime);
+		}
+
+		return blockTimes;
+	}
+
+	template <typename Reverb>
+	double getImpulseResponseEnergy(Reverb& reverb, const int blockLength = blockSize)
+	{
+		juce::AudioBuffer<float> buffer(2, blockLength);
+		const int numberOfBlocks = (int)(impulseResponseSeconds * sampleRate) / blockLength;
+		double energy = 0.0;
+
+		reverb.reset();
+
+		for (int blockIndex = 0; blockIndex < numberOfBlocks; blockIndex++)
+		{
+			buffer.clear();
+
+			if (blockIndex == 0)
+			{
+				buffer.setSample(0, 0, 1.0f);
+				buffer.setSample(1, 0, 1.0f);
+			}
+
+			juce::dsp::AudioBlock<float> block(buffer);
+			reverb.process(juce::dsp::ProcessContextReplacing<float>(block));
+
+			for (int channel = 0; channel < 2; channel++)
+			{
+				for (int frame = 0; frame < blockLength; frame++)
+				{
+					energy += (double)buffer.getSample(channel, frame) * buffer.getSample(channel, frame);
+				}
+			}
+		}
+
+		return energy;
+	}
+
+	template <typename Reverb>
+	void printReverb(const std::string& name, Reverb& reverb, const double referenceEnergy)
+	{
+		const int numberOfBlocks = (int)(renderSeconds * sampleRate) / blockSize;
+		const double blockMilliseconds = 1000.0 * blockSize / sampleRate;
+		const auto blockTimes = renderBlocks(reverb, numberOfBlocks);
+		const double energy = getImpulseResponseEnergy(reverb);
+
+		Benchmark::printRow({
+			name,
+			Benchmark::format(1000.0 * Benchmark::mean(blockTimes), 2),
+			Benchmark::format(1000.0 * Benchmark::percentile(blockTimes, 0.99), 2),
+			Benchmark::format(100.0 * Benchmark::mean(blockTimes) / blockMilliseconds, 2),
+			Benchmark::format(10.0 * std::log10(energy / referenceEnergy), 2) });
+	}
+
+	// A stereo room: decaying noise, a different draw for each side.
+	juce::MemoryBlock createRoomResponseWav()
+	{
+		const int length = (int)(roomResponseSeconds * sampleRate);
+		juce::AudioBuffer<float> buffer(2, length);
+		juce::Random random(2);
+
+		for (int channel = 0; channel < 2; channel++)
+		{
+			for (int frame = 0; frame < length; frame++)
+			{
+				buffer.setSample(channel, frame, 0.1f * (random.nextFloat() * 2.0f - 1.0f) * std::exp(-6.9f * frame / (float)length));
+			}
+		}
+
+		juce::MemoryBlock memoryBlock;
+		juce::WavAudioFormat wavAudioFormat;
+		std::unique_ptr<juce::AudioFormatWriter> writer(wavAudioFormat.createWriterFor(new juce::MemoryOutputStream(memoryBlock, false), sampleRate, 2, 32, {}, 0));
+		writer->writeFromAudioSampleBuffer(buffer, 0, length);
+		writer.reset();
+
+		return memoryBlock;
+	}
+
+	// Convolutions swap in a loaded response from process(), so silent blocks are fed until they have.
+	template <typename Convolution>
+	bool waitUntilLoaded(Convolution& convolution, const int blockLength, const std::function<bool()>& isLoaded)
+	{
+		juce::AudioBuffer<float> buffer(2, blockLength);
+		const double startTime = Benchmark::getMilliseconds();
+
+		while (!isLoaded())
+		{
+			if (Benchmark::getMilliseconds() - startTime > loadTimeoutMilliseconds)
+			{
+				return false;
+			}
+
+			buffer.clear();
+			juce::dsp::AudioBlock<float> block(buffer);
+			convolution.process(juce::dsp::ProcessContextReplacing<float>(block));
+			juce::Thread::sleep(1);
+		}
+
+		convolution.reset();
+		return true;
+	}
+
+	template <typename Convolution>
+	void printConvolution(const std::string& name, Convolution& convolution, const int blockLength, const double referenceEnergy)
+	{
+		const int numberOfBlocks = (int)(renderSeconds * sampleRate) / blockLength;
+		const double blockMilliseconds = 1000.0 * blockLength / sampleRate;
+		const auto blockTimes = renderBlocks(convolution, numberOfBlocks, blockLength);
+		const double energy = getImpulseResponseEnergy(convolution, blockLength);
+
+		Benchmark::printRow({
+			name,
+			std::to_string(blockLength),
+			Benchmark::format(1000.0 * Benchmark::mean(blockTimes), 2),
+			Benchmark::format(1000.0 * Benchmark::percentile(blockTimes, 0.99), 2),
+			Benchmark::format(1000.0 * Benchmark::percentile(blockTimes, 1.0), 2),
+			Benchmark::format(100.0 * Benchmark::mean(blockTimes) / blockMilliseconds, 2),
+			Benchmark::format(10.0 * std::log10(energy / referenceEnergy), 2) });
+	}
+
+	void runConvolutions()
+	{
+		const auto roomResponseWav = createRoomResponseWav();
+		juce::WavAudioFormat wavAudioFormat;
+
+		std::cout << std::endl << roomResponseSeconds << " second room response, level against the audio thread convolution" << std::endl;
+		Benchmark::printHeader({ "convolution", "block", "mean us", "p99 us", "max us", "% of block", "level dB" });
+
+		for (const int blockLength : { 64, 256, 1024 })
+		{
+			juce::dsp::ProcessSpec spec;
+			spec.sampleRate = sampleRate;
+			spec.maximumBlockSize = (juce::uint32)blockLength;
+			spec.numChannels = 2;
+
+			std::unique_ptr<juce::AudioFormatReader> reader(wavAudioFormat.createReaderFor(new juce::MemoryInputStream(roomResponseWav, false), true));
+			juce::AudioBuffer<float> roomResponse((int)reader->numChannels, (int)reader->lengthInSamples);
+			reader->read(&roomResponse, 0, roomResponse.getNumSamples(), 0, true, true);
+			const int roomResponseLength = roomResponse.getNumSamples();
+
+			juce::dsp::Convolution convolution(juce::dsp::Convolution::NonUniform{ Samples::roomConvolutionHeadSize });
+			convolution.loadImpulseResponse(std::move(roomResponse), sampleRate, juce::dsp::Convolution::Stereo::yes, juce::dsp::Convolution::Trim::no, juce::dsp::Convolution::Normalise::no);
+			convolution.prepare(spec);
+
+			PluginRoomConvolution roomConvolution(*reader);
+			roomConvolution.prepare(spec);
+
+			if (!waitUntilLoaded(convolution, blockLength, [&]() { return convolution.getCurrentIRSize() == roomResponseLength; })
+				|| !waitUntilLoaded(roomConvolution, blockLength, [&]() { return roomConvolution.isReady(); }))
+			{
+				std::cout << "room response did not load" << std::endl;
+				return;
+			}
+
+			const double referenceEnergy = getImpulseResponseEnergy(convolution, blockLength);
+			printConvolution("audio thread", convolution, blockLength, referenceEnergy);
+			printConvolution("tail thread", roomConvolution, blockLength, referenceEnergy);
+		}
+	}
+
+	void run()
+	{
+		juce::dsp::ProcessSpec spec;
+		spec.sampleRate = sampleRate;
+		spec.maximumBlockSize = blockSize;
+		spec.numChannels = 2;
+
+		juce::dsp::Reverb reverb;
+		reverb.prepare(spec);
+		reverb.setParameters(getParameters());
+
+		PluginFdnReverb fdnReverb;
+		fdnReverb.prepare(spec);
+		fdnReverb.setParameters(getParameters());
+
+		const double referenceEnergy = getImpulseResponseEnergy(reverb);
+
+		std::cout << renderSeconds << " seconds of output in blocks of " << blockSize << std::endl;
+		Benchmark::printHeader({ "reverb", "mean us", "p99 us", "% of block", "level dB" });
+		printReverb("juce reverb", reverb, referenceEnergy);
+		printReverb("fdn", fdnReverb, referenceEnergy);
+
+		runConvolutions();
+	}
+
+	Benchmark::Registration registration("reverb", "feedback delay network room against juce::dsp::Reverb, and a long room response with and without the tail thread", run);
+}
@@ -0,0 +1,98 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <iostream>
+#include <map>
+
+// Time to bring up plugin instances. The first instance of each round is cold: no other
+// instance is alive, so the shared sample pool starts empty and every sample is decoded. The
+// rest are warm and share the samples the first one loaded. All instances are released
+// between rounds so the next round starts cold again.
+namespace
+{
+	constexpr double sampleRate = 44100.0;
+	constexpr int blockSize = 256;
+	const std::string numberOfInstancesEnvironmentVariable = "PRO_PUNK_DRUMS_BENCHMARK_INSTANCES";
+	const std::string numberOfRoundsEnvironmentVariable = "PRO_PUNK_DRUMS_BENCHMARK_ROUNDS";
+	const std::string constructionId = "construction";
+	const std::string readyId = "ready to play";
+
+	using PhaseTimes = std::map<std::string, std::vector<double>>;
+
+	void addInstance(std::vector<std::unique_ptr<PluginAudioProcessor>>& processors, std::vector<std::string>& phaseNames, PhaseTimes& phaseTimes)
+	{
+		const double startTime = Benchmark::getMilliseconds();
+		auto processor = std::make_unique<PluginAudioProcessor>();
+		const double constructionTime = Benchmark::getMilliseconds() - startTime;
+
+		while (processor->isLoadingSamples())
+		{
+			juce::Thread::sleep(1);
+		}
+
+		processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+		processor->prepareToPlay(sampleRate, blockSize);
+
+		phaseTimes[constructionId].push_back(constructionTime);
+		phaseTimes[readyId].push_back(Benchmark::getMilliseconds() - startTime);
+
+		for (const auto& phase : processor->getLoadTimings().getPhases())
+		{
+			if (std::find(phaseNames.begin(), phaseNames.end(), phase.first) == phaseNames.end())
+			{
+				phaseNames.push_back(phase.first);
+			}
+
+			phaseTimes[phase.first].push_back(phase.second);
+		}
+
+		processors.push_back(std::move(processor));
+	}
+
+	void printPhase(const std::string& phaseName, const std::string& temperature, PhaseTimes& phaseTimes)
+	{
+		const auto& times = phaseTimes[phaseName];
+
+		if (times.empty())
+		{
+			return;
+		}
+
+		Benchmark::printRow({
+			phaseName,
+			temperature,
+			Benchmark::format(Benchmark::percentile(times, 0.5), 1),
+			Benchmark::format(Benchmark::percentile(times, 0.9), 1),
+			Benchmark::format(Benchmark::percentile(times, 0.99), 1) });
+	}
+
+	void run()
+	{
+		const int numberOfInstances = juce::jmax(2, juce::SystemStats::getEnvironmentVariable(numberOfInstancesEnvironmentVariable, juce::String(8)).getIntValue());
+		const int numberOfRounds = juce::jmax(1, juce::SystemStats::getEnvironmentVariable(numberOfRoundsEnvironmentVariable, juce::String(10)).getIntValue());
+
+		std::vector<std::string> phaseNames = { constructionId, readyId };
+		PhaseTimes coldTimes;
+		PhaseTimes warmTimes;
+
+		for (int round = 0; round < numberOfRounds; round++)
+		{
+			std::vector<std::unique_ptr<PluginAudioProcessor>> processors;
+
+			for (int instance = 0; instance < numberOfInstances; instance++)
+			{
+				addInstance(processors, phaseNames, instance == 0 ? coldTimes : warmTimes);
+			}
+		}
+
+		std::cout << numberOfRounds << " rounds of " << numberOfInstances << " instances, milliseconds" << std::endl;
+		Benchmark::printHeader({ "phase", "instance", "p50", "p90", "p99" });
+
+		for (const auto& phaseName : phaseNames)
+		{
+			printPhase(phaseName, "cold", coldTimes);
+			printPhase(phaseName, "warm", warmTimes);
+		}
+	}
+
+	Benchmark::Registration registration("startup", "cold and warm instance load time percentiles per phase", run);
+}
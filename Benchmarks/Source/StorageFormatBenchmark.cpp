@@ -0,0 +1,99 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <iostream>
+#include "../../Source/Synthesiser/PluginSampleStorage.h"
+
+// Sample memory and render cost of the whole kit held in each in-memory storage format, and
+// what decoding each format costs on its own.
+namespace
+{
+	constexpr double sampleRate = 44100.0;
+	constexpr int blockSize = 256;
+	constexpr int numberOfBlocks = 4000; // about 23 seconds of audio
+	constexpr int intervalSamples = 2756; // 32nd notes at 120 BPM
+	constexpr int decodeLength = 1 << 20;
+	constexpr int decodeChunkLength = 258; // a voice's block plus its interpolation frames
+	constexpr int numberOfDecodePasses = 8;
+
+	// Best of a few passes decoding decodeLength samples in voice sized chunks, ns per sample.
+	double timeDecode(const PluginSampleStorage::Format format, float& checksum)
+	{
+		std::vector<float> source((size_t)decodeLength);
+		juce::Random random(1);
+
+		for (auto& sample : source)
+		{
+			sample = random.nextFloat() * 2.0f - 1.0f;
+		}
+
+		std::vector<char> encoded((size_t)decodeLength * (size_t)PluginSampleStorage::bytesPerSample(format));
+		PluginSampleStorage::encode(format, source.data(), encoded.data(), decodeLength);
+
+		std::vector<float> destination((size_t)decodeChunkLength);
+		std::vector<double> passTimes;
+
+		for (int pass = 0; pass < numberOfDecodePasses; pass++)
+		{
+			const double startTime = Benchmark::getMilliseconds();
+
+			for (int startSample = 0; startSample + decodeChunkLength <= decodeLength; startSample += decodeChunkLength)
+			{
+				PluginSampleStorage::decode(format, encoded.data() + (size_t)startSample * (size_t)PluginSampleStorage::bytesPerSample(format), destination.data(), decodeChunkLength);
+				checksum += destination[0];
+			}
+
+			passTimes.push_back(Benchmark::getMilliseconds() - startTime);
+		}
+
+		return 1.0e6 * *std::min_element(passTimes.begin(), passTimes.end()) / (double)decodeLength;
+	}
+
+	void run()
+	{
+		const std::vector<std::string> formatIds = {
+			PluginSampleStorage::float32Id,
+			PluginSampleStorage::int24Id,
+			PluginSampleStorage::int16Id,
+			PluginSampleStorage::float16Id
+		};
+
+		const double blockMilliseconds = 1000.0 * blockSize / sampleRate;
+		double float32MemorySize = 0.0;
+
+		Benchmark::printHeader({ "format", "memory MB", "vs float32", "mean ms", "p99 ms", "% of block" });
+
+		for (const auto& formatId : formatIds)
+		{
+			Benchmark::setEnvironmentVariable(Samples::sampleFormatEnvironmentVariable, formatId);
+			auto processor = Benchmark::createLoadedProcessor(sampleRate, blockSize);
+
+			const double memorySize = (double)processor->getSampleMemorySize();
+			float32MemorySize = formatId == PluginSampleStorage::float32Id ? memorySize : float32MemorySize;
+
+			const auto blockTimes = Benchmark::renderBlocks(*processor, blockSize, numberOfBlocks, processor->getMidiNotesVector(), intervalSamples);
+
+			Benchmark::printRow({
+				formatId,
+				Benchmark::format(memorySize / (1024.0 * 1024.0), 1),
+				Benchmark::format(float32MemorySize > 0.0 ? memorySize / float32MemorySize : 0.0, 2),
+				Benchmark::format(Benchmark::mean(blockTimes)),
+				Benchmark::format(Benchmark::percentile(blockTimes, 0.99)),
+				Benchmark::format(100.0 * Benchmark::mean(blockTimes) / blockMilliseconds, 1) });
+		}
+
+		Benchmark::clearEnvironmentVariable(Samples::sampleFormatEnvironmentVariable);
+		std::cout << std::endl;
+
+		float checksum = 0.0f;
+		Benchmark::printHeader({ "format", "decode ns/sample" });
+
+		for (const auto& formatId : formatIds)
+		{
+			Benchmark::printRow({ formatId, Benchmark::format(timeDecode(PluginSampleStorage::formatFromId(formatId), checksum), 3) });
+		}
+
+		std::cout << "checksum " << checksum << std::endl;
+	}
+
+	Benchmark::Registration registration("storage", "sample memory, render and decode cost per storage format", run);
+}
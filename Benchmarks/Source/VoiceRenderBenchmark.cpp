@@ -0,0 +1,213 @@
+#include "Benchmark.h"
+#include <cmath>
+#include <iostream>
+#include "../../Source/Configuration/Parameters.h"
+#include "../../Source/Synthesiser/PluginSynthesiserSound.h"
+#include "../../Source/Synthesiser/PluginSynthesiserVoice.h"
+
+// Voices one core can render in real time, with the chunked render kernels of
+// PluginSynthesiserVoice against the per-frame loop they replaced. Every voice plays the same
+// stereo sample, either at its own pitch (taken in place) or a semitone up (interpolated).
+namespace
+{
+	constexpr double sampleRate = 44100.0;
+	constexpr int blockSize = 256;
+	constexpr int numberOfVoices = 16;
+	constexpr int rootNote = 60;
+	constexpr double sampleSeconds = 2.0;
+	constexpr double renderSeconds = 1.5; // every voice is still sounding at the end
+	constexpr int numberOfRounds = 20;
+
+	juce::MemoryBlock createSampleWav()
+	{
+		const int length = (int)(sampleSeconds * sampleRate);
+		juce::AudioBuffer<float> buffer(2, length);
+		juce::Random random(1);
+
+		for (int channel = 0; channel < 2; channel++)
+		{
+			for (int frame = 0; frame < length; frame++)
+			{
+				buffer.setSample(channel, frame, (random.nextFloat() * 2.0f - 1.0f) * std::exp(-3.0f * frame / (float)length));
+			}
+		}
+
+		juce::MemoryBlock memoryBlock;
+		juce::WavAudioFormat wavAudioFormat;
+		std::unique_ptr<juce::AudioFormatWriter> writer(wavAudioFormat.createWriterFor(new juce::MemoryOutputStream(memoryBlock, false), sampleRate, 2, 24, {}, 0));
+		writer->writeFromAudioSampleBuffer(buffer, 0, length);
+		writer.reset();
+
+		return memoryBlock;
+	}
+
+	// The render loop before the kernels were split: interpolation, envelope, gain ramp,
+	// channel layout and end of sample all handled per frame.
+	struct PerFrameVoice {
+		const juce::AudioBuffer<float>* data = nullptr;
+		double position = 0.0;
+		double pitchRatio = 1.0;
+		float gain = 0.8f;
+		juce::ADSR adsr;
+
+		void render(juce::AudioBuffer<float>& outputBuffer)
+		{
+			const float* inL = data->getReadPointer(0);
+			const float* inR = data->getNumChannels() > 1 ? data->getReadPointer(1) : nullptr;
+			float* outL = outputBuffer.getWritePointer(0);
+			float* outR = outputBuffer.getNumChannels() > 1 ? outputBuffer.getWritePointer(1) : nullptr;
+			const int length = data->getNumSamples() - 1;
+
+			for (int frame = 0; frame < outputBuffer.getNumSamples(); frame++)
+			{
+				const auto pos = (int)position;
+				float l, r;
+
+				if (pitchRatio == 1.0)
+				{
+					l = inL[pos];
+					r = inR != nullptr ? inR[pos] : l;
+				}
+				else
+				{
+					const auto alpha = (float)(position - (double)pos);
+					const auto invAlpha = 1.0f - alpha;
+
+					l = inL[pos] * invAlpha + inL[pos + 1] * alpha;
+					r = inR != nullptr ? inR[pos] * invAlpha + inR[pos + 1] * alpha : l;
+				}
+
+				const float envelopeValue = adsr.getNextSample();
+				l *= gain * envelopeValue;
+				r *= gain * envelopeValue;
+
+				if (outR != nullptr)
+				{
+					*outL++ += l;
+					*outR++ += r;
+				}
+				else
+				{
+					*outL++ += (l + r) * 0.5f;
+				}
+
+				position += pitchRatio;
+
+				if (position > length)
+				{
+					return;
+				}
+			}
+		}
+	};
+
+	// Nanoseconds per voice per output frame.
+	double timePerFrameVoice(const std::function<void()>& startVoices, const std::function<void(juce::AudioBuffer<float>&)>& renderBlock)
+	{
+		juce::AudioBuffer<float> outputBuffer(2, blockSize);
+		const int numberOfBlocks = (int)(renderSeconds * sampleRate) / blockSize;
+		std::vector<double> roundTimes;
+
+		for (int round = 0; round < numberOfRounds; round++)
+		{
+			startVoices();
+			const double startTime = Benchmark::getMilliseconds();
+
+			for (int block = 0; block < numberOfBlocks; block++)
+			{
+				outputBuffer.clear();
+				renderBlock(outputBuffer);
+			}
+
+			roundTimes.push_back(Benchmark::getMilliseconds() - startTime);
+		}
+
+		return 1.0e6 * Benchmark::percentile(roundTimes, 0.5) / ((double)numberOfBlocks * blockSize * numberOfVoices);
+	}
+
+	void run()
+	{
+		const auto sampleWav = createSampleWav();
+		juce::WavAudioFormat wavAudioFormat;
+		std::unique_ptr<juce::AudioFormatReader> reader(wavAudioFormat.createReaderFor(new juce::MemoryInputStream(sampleWav, false), true));
+		auto sampleData = std::make_shared<const PluginSampleData>(*reader, sampleSeconds + 1.0);
+
+		juce::BigInteger midiNotes;
+		midiNotes.setRange(0, 128, true);
+		auto* sound = new PluginSynthesiserSound("benchmark", sampleData, midiNotes, rootNote, 0.0, 0.0);
+		sound->prepareResampledData(sampleRate);
+
+		juce::AudioParameterFloat gainParameter(juce::ParameterID{ AudioParameters::gainComponentId, 1 }, AudioParameters::gainComponentId, AudioParameters::gainNormalisableRange, AudioParameters::gainDeciblesDefaultValue);
+		juce::AudioParameterFloat panParameter(juce::ParameterID{ "pan", 1 }, "pan", AudioParameters::panNormalisableRange, 0.0f);
+		juce::AudioParameterBool phaseParameter(juce::ParameterID{ "phase", 1 }, "phase", false);
+
+		juce::Synthesiser synthesiser;
+		synthesiser.setCurrentPlaybackSampleRate(sampleRate);
+		synthesiser.addSound(sound);
+
+		for (int voiceIndex = 0; voiceIndex < numberOfVoices; voiceIndex++)
+		{
+			auto* voice = new PluginSynthesiserVoice();
+			voice->setParameters(gainParameter, panParameter, phaseParameter);
+			synthesiser.addVoice(voice);
+		}
+
+		std::vector<PerFrameVoice> perFrameVoices((size_t)numberOfVoices);
+		juce::MidiBuffer noMidi;
+
+		Benchmark::printHeader({ "render", "pitch", "ns/voice frame", "voices/core" });
+
+		for (const int semitones : { 0, 1 })
+		{
+			const int midiNote = rootNote + semitones;
+			const double pitchRatio = std::pow(2.0, semitones / 12.0);
+
+			const double perFrameTime = timePerFrameVoice([&]()
+				{
+					for (auto& voice : perFrameVoices)
+					{
+						voice.data = sampleData->mData.get();
+						voice.position = 0.0;
+						voice.pitchRatio = pitchRatio;
+						voice.adsr.setSampleRate(sampleRate);
+						voice.adsr.noteOn();
+					}
+				},
+				[&](juce::AudioBuffer<float>& outputBuffer)
+				{
+					for (auto& voice : perFrameVoices)
+					{
+						voice.render(outputBuffer);
+					}
+				});
+
+			const double chunkedTime = timePerFrameVoice([&]()
+				{
+					synthesiser.allNotesOff(0, false);
+
+					// One MIDI channel per voice so no note retriggers another voice's.
+					for (int voiceIndex = 0; voiceIndex < numberOfVoices; voiceIndex++)
+					{
+						synthesiser.noteOn(voiceIndex % 16 + 1, midiNote, 0.8f);
+					}
+				},
+				[&](juce::AudioBuffer<float>& outputBuffer)
+				{
+					synthesiser.renderNextBlock(outputBuffer, noMidi, 0, blockSize);
+				});
+
+			const std::string pitch = semitones == 0 ? "in place" : "interpolated";
+
+			for (const auto& nameAndTime : { std::make_pair(std::string("per frame"), perFrameTime), std::make_pair(std::string("chunked"), chunkedTime) })
+			{
+				Benchmark::printRow({
+					nameAndTime.first,
+					pitch,
+					Benchmark::format(nameAndTime.second, 2),
+					Benchmark::format(1.0e9 / (nameAndTime.second * sampleRate), 0) });
+			}
+		}
+	}
+
+	Benchmark::Registration registration("voices", "voices per core, chunked render kernels against the per-frame loop", run);
+}
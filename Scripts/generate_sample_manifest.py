@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+Writes Source/Configuration/SampleManifest.h, the table of embedded samples the
+plugin iterates instead of parsing BinaryData resource names at runtime.
+
+Run it from the repository root whenever samples are added to or removed from the
+Assets group in Pro Punk Drums.jucer, and commit the result alongside the project.
+
+Resource names follow <general midi name>[_<velocity>][_<variation>][_<mic>].wav,
+the same rules the processor used to apply when it parsed them itself.
+"""
+
+import re
+import sys
+import xml.etree.ElementTree as ElementTree
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+JUCER_PATH = ROOT / "Pro Punk Drums.jucer"
+GENERAL_MIDI_PATH = ROOT / "Source" / "Configuration" / "GeneralMidi.h"
+OUTPUT_PATH = ROOT / "Source" / "Configuration" / "SampleManifest.h"
+
+
+def snake_case(name):
+    return name.replace(" ", "_").replace("-", "_").lower()
+
+
+def binary_data_identifier(file_name):
+    # Matches the names Projucer gives BinaryData resources.
+    identifier = re.sub(r"[^A-Za-z0-9_]", "", file_name.replace(" ", "_").replace(".", "_"))
+    return "_" + identifier if identifier[:1].isdigit() else identifier
+
+
+def read_general_midi_names():
+    source = GENERAL_MIDI_PATH.read_text()
+    notes = dict(re.findall(r"static constexpr int (\w+)Note = (\d+);", source))
+    names = re.findall(r'static const std::string (\w+)Name = "([^"]+)";', source)
+    return [(name, int(notes[key])) for key, name in names if key in notes]
+
+
+def parse_resource(stem, general_midi_names):
+    """Yields (midi note, velocity index, variation index, mic id) for every name stem matches."""
+    for midi_name, midi_note in general_midi_names:
+        prefix = snake_case(midi_name)
+
+        if not stem.startswith(prefix):
+            continue
+
+        parts = [part for part in stem[len(prefix):].split("_") if part]
+
+        if len(parts) == 0:
+            yield midi_note, 0, 0, ""
+        elif len(parts) == 1:
+            if parts[0].isdigit():
+                yield midi_note, 0, int(parts[0]) - 1, ""
+            else:
+                yield midi_note, 0, 0, parts[0]
+        elif len(parts) == 2:
+            if parts[0].isdigit() and parts[1].isdigit():
+                yield midi_note, int(parts[0]) - 1, int(parts[1]) - 1, ""
+            elif parts[0].isdigit():
+                yield midi_note, 0, int(parts[0]) - 1, parts[1]
+        elif len(parts) == 3 and parts[0].isdigit() and parts[1].isdigit():
+            yield midi_note, int(parts[0]) - 1, int(parts[1]) - 1, parts[2]
+        else:
+            print("invalid name " + stem, file=sys.stderr)
+
+
+def main():
+    general_midi_names = read_general_midi_names()
+    rows = []
+
+    for file_element in ElementTree.parse(JUCER_PATH).iter("FILE"):
+        file_name = file_element.get("name", "")
+
+        if file_element.get("resource") != "1" or not file_name.lower().endswith(".wav"):
+            continue
+
+        identifier = binary_data_identifier(file_name)
+
+        for midi_note, velocity_index, variation_index, mic_id in parse_resource(file_name[:-4], general_midi_names):
+            rows.append((midi_note, velocity_index, variation_index, mic_id, identifier))
+
+    rows.sort()
+
+    lines = [
+        "#pragma once",
+        "#include <JuceHeader.h>",
+        "",
+        "// Generated by Scripts/generate_sample_manifest.py from the resources in Pro Punk Drums.jucer, do not edit.",
+        "namespace SampleManifest",
+        "{",
+        "\tstruct Entry {",
+        "\t\tint midiNote;",
+        "\t\tint velocityIndex;",
+        "\t\tint variationIndex;",
+        "\t\tconst char* micId; // \"\" for single mic samples",
+        "\t\tconst char* resourceName;",
+        "\t\tconst char* const* data;",
+        "\t\tint dataSize;",
+        "\t};",
+        "",
+        "\tstatic constexpr Entry entries[] = {",
+    ]
+
+    for midi_note, velocity_index, variation_index, mic_id, identifier in rows:
+        lines.append('\t\t{{ {}, {}, {}, "{}", "{}", &BinaryData::{}, BinaryData::{}Size }},'.format(
+            midi_note, velocity_index, variation_index, mic_id, identifier, identifier, identifier))
+
+    lines += [
+        "\t};",
+        "",
+        "\tstatic constexpr int size = (int)(sizeof(entries) / sizeof(entries[0]));",
+        "}",
+        "",
+    ]
+
+    OUTPUT_PATH.write_text("\n".join(lines))
+    print("wrote {} entries to {}".format(len(rows), OUTPUT_PATH.relative_to(ROOT)))
+
+
+if __name__ == "__main__":
+    main()
@@ -2,11 +2,12 @@
 #include <JuceHeader.h>
 #include "OutputParametersComponent.h"
 
-class OutputsComponent : public juce::Component, private juce::ComboBox::Listener, public juce::Button::Listener, private juce::Timer
+class OutputsComponent : public juce::Component, private juce::ComboBox::Listener, public juce::Button::Listener
 {
 public:
-    OutputsComponent(juce::AudioProcessorValueTreeState& apvts, std::function<void(int, float)> onDrumMidiButtonClicked) :
-        mOnDrumMidiButtonClicked(onDrumMidiButtonClicked),
+    OutputsComponent(juce::AudioProcessorValueTreeState& apvts, std::function<void(int, float)> onAuditionLoopStarted, std::function<void()> onAuditionLoopStopped) :
+        mOnAuditionLoopStarted(onAuditionLoopStarted),
+        mOnAuditionLoopStopped(onAuditionLoopStopped),
         mApvts(apvts)
     {
         mOutputParametersComponent.reset(new OutputParametersComponent(apvts));
@@ -25,6 +26,14 @@ public:
 
     };
 
+    ~OutputsComponent() override
+    {
+        if (mIsPlaying && mOnAuditionLoopStopped.has_value())
+        {
+            mOnAuditionLoopStopped.value()();
+        }
+    }
+
     void resized() override
     {
         auto bounds = getLocalBounds();
@@ -33,7 +42,9 @@ public:
         if (mChannelReverbGainSliderPtr != nullptr)
         {
             topArea.removeFromRight(12);
-            mChannelReverbGainSliderPtr->setBounds(topArea.removeFromRight(64).reduced(0, 24));
+            auto reverbArea = topArea.removeFromRight(64);
+            mChannelReverbGainSliderPtr->setBounds(reverbArea.reduced(0, 24));
+            mChannelReverbPostFaderToggleButtonPtr->setBounds(reverbArea.removeFromBottom(24));
         }
        
         if (mChannelOutputGainSliderPtr != nullptr)
@@ -63,6 +74,7 @@ public:
     {
         mChannelOutputGainAttachmentPtr.reset();
         mChannelReverbGainAttachmentPtr.reset();
+        mChannelReverbPostFaderAttachmentPtr.reset();
 
         const auto& channelId = Channels::channelIndexToIdMap.at(channelIndex);
         const auto& channelName = stringToTitleCase(channelId);
@@ -76,6 +88,11 @@ public:
         mMidiNoteValue = channelMidi;
         addAndMakeVisible(mNoteOnButtonPtr.get());
 
+        if (mIsPlaying && mOnAuditionLoopStarted.has_value())
+        {
+            mOnAuditionLoopStarted.value()(mMidiNoteValue, 0.75f);
+        }
+
         const auto channelOutputGainParameterId = stringsJoinAndSnakeCase({ channelId, AudioParameters::gainComponentId });
 
         mChannelOutputGainSliderPtr.reset(new juce::Slider(juce::Slider::RotaryHorizontalVerticalDrag, juce::Slider::TextBoxBelow));
@@ -93,6 +110,7 @@ public:
 
         mChannelReverbGainSliderPtr.reset();
         mChannelReverbGainSliderLabelPtr.reset();
+        mChannelReverbPostFaderToggleButtonPtr.reset();
 
         if (channelIndex != Channels::roomChannelIndex && channelIndex != Channels::outputChannelIndex)
         {
@@ -110,6 +128,15 @@ public:
             mChannelReverbGainSliderLabelPtr->setText(Strings::roomSend, juce::dontSendNotification);
             mChannelReverbGainSliderLabelPtr->attachToComponent(mChannelReverbGainSliderPtr.get(), false);
             addAndMakeVisible(mChannelReverbGainSliderLabelPtr.get());
+
+            const auto channelReverbPostFaderParameterId = stringsJoinAndSnakeCase({ channelId, AudioParameters::reverbComponentId, AudioParameters::postFaderComponentId });
+
+            mChannelReverbPostFaderToggleButtonPtr.reset(new juce::ToggleButton(Strings::postFader));
+            mChannelReverbPostFaderAttachmentPtr = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+                mApvts,
+                channelReverbPostFaderParameterId,
+                *mChannelReverbPostFaderToggleButtonPtr);
+            addAndMakeVisible(mChannelReverbPostFaderToggleButtonPtr.get());
         }
 
         resized();
@@ -131,37 +158,28 @@ private:
     std::unique_ptr<juce::Label> mChannelReverbGainSliderLabelPtr;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> mChannelReverbGainAttachmentPtr;
 
+    std::unique_ptr<juce::ToggleButton> mChannelReverbPostFaderToggleButtonPtr;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> mChannelReverbPostFaderAttachmentPtr;
+
     std::unique_ptr<juce::TextButton> mNoteOnButtonPtr;
 
     bool mIsPlaying = false;
     int mMidiNoteValue = -1;
 
-    std::optional<std::function<void(int, float)>> mOnDrumMidiButtonClicked;
+    std::optional<std::function<void(int, float)>> mOnAuditionLoopStarted;
+    std::optional<std::function<void()>> mOnAuditionLoopStopped;
 
     void buttonClicked(juce::Button* button) override
     {
         mIsPlaying = !mIsPlaying;
 
-        if (mIsPlaying && mOnDrumMidiButtonClicked.has_value())
-        {
-            mOnDrumMidiButtonClicked.value()(mMidiNoteValue, 0.75f);
-        }
-
-        if (mIsPlaying)
+        if (mIsPlaying && mOnAuditionLoopStarted.has_value())
         {
-            startTimer(1000);
+            mOnAuditionLoopStarted.value()(mMidiNoteValue, 0.75f);
         }
-        else
-        {
-            stopTimer();
-        }
-    };
-
-    void timerCallback() override
-    {
-        if (mIsPlaying && mOnDrumMidiButtonClicked.has_value())
+        else if (!mIsPlaying && mOnAuditionLoopStopped.has_value())
         {
-            mOnDrumMidiButtonClicked.value()(mMidiNoteValue, 0.75f);
+            mOnAuditionLoopStopped.value()();
         }
     };
 
@@ -19,9 +19,11 @@ public:
         const std::string roomSizeParameterId,
         const std::string dampingParameterId,
         const std::string widthParameterId,
+        const std::string denseRoomParameterId,
         const std::string roomSizeTitle = "Room size",
         const std::string dampingTitle = "Damping",
-        const std::string widthTitle = "Width")
+        const std::string widthTitle = "Width",
+        const std::string denseRoomTitle = "Dense room")
     {
         mRoomSizeSliderPtr.reset(new juce::Slider(juce::Slider::RotaryVerticalDrag, juce::Slider::TextBoxBelow));
         mRoomSizeSliderPtr->setTitle(roomSizeTitle);
@@ -64,6 +66,13 @@ public:
         mWidthLabelPtr->setText(widthTitle, juce::dontSendNotification);
         mWidthLabelPtr->attachToComponent(mWidthSliderPtr.get(), false);
         addAndMakeVisible(mWidthLabelPtr.get());
+
+        mDenseRoomToggleButtonPtr.reset(new juce::ToggleButton(denseRoomTitle));
+        mDenseRoomAttachmentPtr = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+            apvts,
+            denseRoomParameterId,
+            *mDenseRoomToggleButtonPtr);
+        addAndMakeVisible(mDenseRoomToggleButtonPtr.get());
     }
 
     ~ReverbComponent()
@@ -71,6 +80,7 @@ public:
         mRoomSizeAttachmentPtr.reset();
         mDampingAttachmentPtr.reset();
         mWidthAttachmentPtr.reset();
+        mDenseRoomAttachmentPtr.reset();
 
         mRoomSizeSliderPtr.reset();
         mDampingSliderPtr.reset();
@@ -79,11 +89,14 @@ public:
         mRoomSizeLabelPtr.reset();
         mDampingLabelPtr.reset();
         mWidthLabelPtr.reset();
+
+        mDenseRoomToggleButtonPtr.reset();
     }
 
     void resized() override
     {
         auto bounds = getLocalBounds().reduced(10);
+        mDenseRoomToggleButtonPtr->setBounds(bounds.removeFromBottom(24).withTrimmedLeft(12));
 
         juce::FlexBox flexBox;
         flexBox.flexDirection = juce::FlexBox::Direction::row;
@@ -109,4 +122,6 @@ private:
     std::unique_ptr<juce::Label> mRoomSizeLabelPtr, mDampingLabelPtr, mWidthLabelPtr;
     std::unique_ptr<juce::Slider> mRoomSizeSliderPtr, mDampingSliderPtr, mWidthSliderPtr;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> mRoomSizeAttachmentPtr, mDampingAttachmentPtr, mWidthAttachmentPtr;
+    std::unique_ptr<juce::ToggleButton> mDenseRoomToggleButtonPtr;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> mDenseRoomAttachmentPtr;
 };
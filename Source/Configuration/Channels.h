@@ -15,6 +15,11 @@ namespace Channels {
 
 	static constexpr int size = 8;
 
+	// Helper threads processing the drum channel strips in parallel with the audio thread,
+	// 0 processes them serially. Overridable through the environment.
+	static constexpr int workersDefault = 0;
+	static const std::string workersEnvironmentVariable = "PRO_PUNK_DRUMS_CHANNEL_WORKERS";
+
 	static const std::string kickId = "kick";
 	static const std::string snareId = "snare";
 	static const std::string tomsId = "toms";
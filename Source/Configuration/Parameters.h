@@ -3,6 +3,7 @@
 #include <string>
 #include "../PluginUtils.h"
 #include "GeneralMidi.h"
+#include "SampleManifest.h"
 #include <juce_audio_utils/juce_audio_utils.h>
 #include <juce_core/juce_core.h>
 
@@ -167,6 +168,8 @@ namespace AudioParameters
 
 	static constexpr float reverbGainDefaultValue = 0.05f;
 
+	static const std::string postFaderComponentId = "post_fader"; // room send taken after the channel strip
+
 	static const std::string roomSizeComponentId = "room_size";
 	static constexpr float roomSizeMinimumValue = 0.00f;
 	static constexpr float roomSizeMaximumValue = 1.00f;
@@ -200,6 +203,8 @@ namespace AudioParameters
 			widthIntervalValue);
 	static constexpr float widthDefaultValue = 1.0f;
 
+	static const std::string denseRoomComponentId = "dense_room"; // the delay network reverb instead of Freeverb
+
 	static const std::string dryWetComponentId = "blend";
 
 	static constexpr float dryWetMinimumValue = 0.0f;
@@ -217,77 +222,9 @@ namespace AudioParameters
 	{
 		std::map<int, std::set<std::string>> uniqueMidiNoteMicCombinations;
 
-		for (int resourceIndex = 0; resourceIndex < BinaryData::namedResourceListSize; resourceIndex++)
+		for (const auto& manifestEntry : SampleManifest::entries)
 		{
-			std::string namedResource = BinaryData::namedResourceList[resourceIndex];
-			std::string micId, midiName, generalMidiSnakeCaseName = "";
-			int midiNote = -1;
-
-			for (auto midiNameIndex = 0; midiNameIndex < GeneralMidiPercussion::midiNamesVector.size(); midiNameIndex++)
-			{
-				midiName = GeneralMidiPercussion::midiNamesVector.at(midiNameIndex);
-				generalMidiSnakeCaseName = stringToSnakeCase(midiName);
-
-				std::string cleanedNamedResource = namedResource.substr(0, namedResource.size() - 4);
-				size_t pos = cleanedNamedResource.find(generalMidiSnakeCaseName);
-				if (pos == 0)
-				{
-					std::string resourceMetadata = cleanedNamedResource.substr(pos + generalMidiSnakeCaseName.length());
-
-					std::istringstream iss(resourceMetadata);
-					std::vector<std::string> parts;
-					std::string part;
-
-					while (std::getline(iss, part, '_')) {
-						if (!part.empty()) {
-							parts.push_back(part);
-						}
-					}
-
-					switch (parts.size()) {
-					case 0:
-						midiNote = GeneralMidiPercussion::midiNameToNoteMap.at(midiName);
-						break;
-					case 1:
-						midiNote = GeneralMidiPercussion::midiNameToNoteMap.at(midiName);
-						if (!stringIsNumeric(parts[0]))
-						{
-							micId = parts[0];
-						}
-						break;
-					case 2:
-						if (stringIsNumeric(parts[1]))
-						{
-							midiNote = GeneralMidiPercussion::midiNameToNoteMap.at(midiName);
-						}
-						else
-						{
-							midiNote = GeneralMidiPercussion::midiNameToNoteMap.at(midiName);
-							micId = parts[1];
-						}
-						break;
-					case 3:
-						if (stringIsNumeric(parts[1]))
-						{
-							midiNote = GeneralMidiPercussion::midiNameToNoteMap.at(midiName);
-							micId = parts[2];
-						}
-						else
-						{
-							midiNameIndex = (int)GeneralMidiPercussion::midiNamesVector.size() + 1;
-						}
-						break;
-					default:
-						midiNameIndex = (int)GeneralMidiPercussion::midiNamesVector.size() + 1;
-						break;
-					}
-				}
-			}
-
-			if (midiNote != -1)
-			{
-				uniqueMidiNoteMicCombinations[midiNote].insert(micId);
-			}
+			uniqueMidiNoteMicCombinations[manifestEntry.midiNote].insert(manifestEntry.micId);
 		}
 
 		return uniqueMidiNoteMicCombinations;
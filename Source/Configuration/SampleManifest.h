@@ -0,0 +1,441 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Generated by Scripts/generate_sample_manifest.py from the resources in Pro Punk Drums.jucer, do not edit.
+namespace SampleManifest
+{
+	struct Entry {
+		int midiNote;
+		int velocityIndex;
+		int variationIndex;
+		const char* micId; // "" for single mic samples
+		const char* resourceName;
+		const char* const* data;
+		int dataSize;
+	};
+
+	static constexpr Entry entries[] = {
+		{ 35, 0, 0, "in", "acoustic_bass_drum_1_1_in_wav", &BinaryData::acoustic_bass_drum_1_1_in_wav, BinaryData::acoustic_bass_drum_1_1_in_wavSize },
+		{ 35, 0, 0, "out", "acoustic_bass_drum_1_1_out_wav", &BinaryData::acoustic_bass_drum_1_1_out_wav, BinaryData::acoustic_bass_drum_1_1_out_wavSize },
+		{ 35, 0, 1, "in", "acoustic_bass_drum_1_2_in_wav", &BinaryData::acoustic_bass_drum_1_2_in_wav, BinaryData::acoustic_bass_drum_1_2_in_wavSize },
+		{ 35, 0, 1, "out", "acoustic_bass_drum_1_2_out_wav", &BinaryData::acoustic_bass_drum_1_2_out_wav, BinaryData::acoustic_bass_drum_1_2_out_wavSize },
+		{ 35, 0, 2, "in", "acoustic_bass_drum_1_3_in_wav", &BinaryData::acoustic_bass_drum_1_3_in_wav, BinaryData::acoustic_bass_drum_1_3_in_wavSize },
+		{ 35, 0, 2, "out", "acoustic_bass_drum_1_3_out_wav", &BinaryData::acoustic_bass_drum_1_3_out_wav, BinaryData::acoustic_bass_drum_1_3_out_wavSize },
+		{ 35, 0, 3, "in", "acoustic_bass_drum_1_4_in_wav", &BinaryData::acoustic_bass_drum_1_4_in_wav, BinaryData::acoustic_bass_drum_1_4_in_wavSize },
+		{ 35, 0, 3, "out", "acoustic_bass_drum_1_4_out_wav", &BinaryData::acoustic_bass_drum_1_4_out_wav, BinaryData::acoustic_bass_drum_1_4_out_wavSize },
+		{ 35, 0, 4, "in", "acoustic_bass_drum_1_5_in_wav", &BinaryData::acoustic_bass_drum_1_5_in_wav, BinaryData::acoustic_bass_drum_1_5_in_wavSize },
+		{ 35, 0, 4, "out", "acoustic_bass_drum_1_5_out_wav", &BinaryData::acoustic_bass_drum_1_5_out_wav, BinaryData::acoustic_bass_drum_1_5_out_wavSize },
+		{ 35, 1, 0, "in", "acoustic_bass_drum_2_1_in_wav", &BinaryData::acoustic_bass_drum_2_1_in_wav, BinaryData::acoustic_bass_drum_2_1_in_wavSize },
+		{ 35, 1, 0, "out", "acoustic_bass_drum_2_1_out_wav", &BinaryData::acoustic_bass_drum_2_1_out_wav, BinaryData::acoustic_bass_drum_2_1_out_wavSize },
+		{ 35, 1, 1, "in", "acoustic_bass_drum_2_2_in_wav", &BinaryData::acoustic_bass_drum_2_2_in_wav, BinaryData::acoustic_bass_drum_2_2_in_wavSize },
+		{ 35, 1, 1, "out", "acoustic_bass_drum_2_2_out_wav", &BinaryData::acoustic_bass_drum_2_2_out_wav, BinaryData::acoustic_bass_drum_2_2_out_wavSize },
+		{ 35, 1, 2, "in", "acoustic_bass_drum_2_3_in_wav", &BinaryData::acoustic_bass_drum_2_3_in_wav, BinaryData::acoustic_bass_drum_2_3_in_wavSize },
+		{ 35, 1, 2, "out", "acoustic_bass_drum_2_3_out_wav", &BinaryData::acoustic_bass_drum_2_3_out_wav, BinaryData::acoustic_bass_drum_2_3_out_wavSize },
+		{ 35, 1, 3, "in", "acoustic_bass_drum_2_4_in_wav", &BinaryData::acoustic_bass_drum_2_4_in_wav, BinaryData::acoustic_bass_drum_2_4_in_wavSize },
+		{ 35, 1, 3, "out", "acoustic_bass_drum_2_4_out_wav", &BinaryData::acoustic_bass_drum_2_4_out_wav, BinaryData::acoustic_bass_drum_2_4_out_wavSize },
+		{ 35, 1, 4, "in", "acoustic_bass_drum_2_5_in_wav", &BinaryData::acoustic_bass_drum_2_5_in_wav, BinaryData::acoustic_bass_drum_2_5_in_wavSize },
+		{ 35, 1, 4, "out", "acoustic_bass_drum_2_5_out_wav", &BinaryData::acoustic_bass_drum_2_5_out_wav, BinaryData::acoustic_bass_drum_2_5_out_wavSize },
+		{ 35, 2, 0, "in", "acoustic_bass_drum_3_1_in_wav", &BinaryData::acoustic_bass_drum_3_1_in_wav, BinaryData::acoustic_bass_drum_3_1_in_wavSize },
+		{ 35, 2, 0, "out", "acoustic_bass_drum_3_1_out_wav", &BinaryData::acoustic_bass_drum_3_1_out_wav, BinaryData::acoustic_bass_drum_3_1_out_wavSize },
+		{ 35, 2, 1, "in", "acoustic_bass_drum_3_2_in_wav", &BinaryData::acoustic_bass_drum_3_2_in_wav, BinaryData::acoustic_bass_drum_3_2_in_wavSize },
+		{ 35, 2, 1, "out", "acoustic_bass_drum_3_2_out_wav", &BinaryData::acoustic_bass_drum_3_2_out_wav, BinaryData::acoustic_bass_drum_3_2_out_wavSize },
+		{ 35, 2, 2, "in", "acoustic_bass_drum_3_3_in_wav", &BinaryData::acoustic_bass_drum_3_3_in_wav, BinaryData::acoustic_bass_drum_3_3_in_wavSize },
+		{ 35, 2, 2, "out", "acoustic_bass_drum_3_3_out_wav", &BinaryData::acoustic_bass_drum_3_3_out_wav, BinaryData::acoustic_bass_drum_3_3_out_wavSize },
+		{ 35, 2, 3, "in", "acoustic_bass_drum_3_4_in_wav", &BinaryData::acoustic_bass_drum_3_4_in_wav, BinaryData::acoustic_bass_drum_3_4_in_wavSize },
+		{ 35, 2, 3, "out", "acoustic_bass_drum_3_4_out_wav", &BinaryData::acoustic_bass_drum_3_4_out_wav, BinaryData::acoustic_bass_drum_3_4_out_wavSize },
+		{ 35, 2, 4, "in", "acoustic_bass_drum_3_5_in_wav", &BinaryData::acoustic_bass_drum_3_5_in_wav, BinaryData::acoustic_bass_drum_3_5_in_wavSize },
+		{ 35, 2, 4, "out", "acoustic_bass_drum_3_5_out_wav", &BinaryData::acoustic_bass_drum_3_5_out_wav, BinaryData::acoustic_bass_drum_3_5_out_wavSize },
+		{ 36, 0, 0, "in", "bass_drum_1_1_1_in_wav", &BinaryData::bass_drum_1_1_1_in_wav, BinaryData::bass_drum_1_1_1_in_wavSize },
+		{ 36, 0, 0, "out", "bass_drum_1_1_1_out_wav", &BinaryData::bass_drum_1_1_1_out_wav, BinaryData::bass_drum_1_1_1_out_wavSize },
+		{ 36, 0, 1, "in", "bass_drum_1_1_2_in_wav", &BinaryData::bass_drum_1_1_2_in_wav, BinaryData::bass_drum_1_1_2_in_wavSize },
+		{ 36, 0, 1, "out", "bass_drum_1_1_2_out_wav", &BinaryData::bass_drum_1_1_2_out_wav, BinaryData::bass_drum_1_1_2_out_wavSize },
+		{ 36, 0, 2, "in", "bass_drum_1_1_3_in_wav", &BinaryData::bass_drum_1_1_3_in_wav, BinaryData::bass_drum_1_1_3_in_wavSize },
+		{ 36, 0, 2, "out", "bass_drum_1_1_3_out_wav", &BinaryData::bass_drum_1_1_3_out_wav, BinaryData::bass_drum_1_1_3_out_wavSize },
+		{ 36, 0, 3, "in", "bass_drum_1_1_4_in_wav", &BinaryData::bass_drum_1_1_4_in_wav, BinaryData::bass_drum_1_1_4_in_wavSize },
+		{ 36, 0, 3, "out", "bass_drum_1_1_4_out_wav", &BinaryData::bass_drum_1_1_4_out_wav, BinaryData::bass_drum_1_1_4_out_wavSize },
+		{ 36, 0, 4, "in", "bass_drum_1_1_5_in_wav", &BinaryData::bass_drum_1_1_5_in_wav, BinaryData::bass_drum_1_1_5_in_wavSize },
+		{ 36, 0, 4, "out", "bass_drum_1_1_5_out_wav", &BinaryData::bass_drum_1_1_5_out_wav, BinaryData::bass_drum_1_1_5_out_wavSize },
+		{ 36, 1, 0, "in", "bass_drum_1_2_1_in_wav", &BinaryData::bass_drum_1_2_1_in_wav, BinaryData::bass_drum_1_2_1_in_wavSize },
+		{ 36, 1, 0, "out", "bass_drum_1_2_1_out_wav", &BinaryData::bass_drum_1_2_1_out_wav, BinaryData::bass_drum_1_2_1_out_wavSize },
+		{ 36, 1, 1, "in", "bass_drum_1_2_2_in_wav", &BinaryData::bass_drum_1_2_2_in_wav, BinaryData::bass_drum_1_2_2_in_wavSize },
+		{ 36, 1, 1, "out", "bass_drum_1_2_2_out_wav", &BinaryData::bass_drum_1_2_2_out_wav, BinaryData::bass_drum_1_2_2_out_wavSize },
+		{ 36, 1, 2, "in", "bass_drum_1_2_3_in_wav", &BinaryData::bass_drum_1_2_3_in_wav, BinaryData::bass_drum_1_2_3_in_wavSize },
+		{ 36, 1, 2, "out", "bass_drum_1_2_3_out_wav", &BinaryData::bass_drum_1_2_3_out_wav, BinaryData::bass_drum_1_2_3_out_wavSize },
+		{ 36, 1, 3, "in", "bass_drum_1_2_4_in_wav", &BinaryData::bass_drum_1_2_4_in_wav, BinaryData::bass_drum_1_2_4_in_wavSize },
+		{ 36, 1, 3, "out", "bass_drum_1_2_4_out_wav", &BinaryData::bass_drum_1_2_4_out_wav, BinaryData::bass_drum_1_2_4_out_wavSize },
+		{ 36, 1, 4, "in", "bass_drum_1_2_5_in_wav", &BinaryData::bass_drum_1_2_5_in_wav, BinaryData::bass_drum_1_2_5_in_wavSize },
+		{ 36, 1, 4, "out", "bass_drum_1_2_5_out_wav", &BinaryData::bass_drum_1_2_5_out_wav, BinaryData::bass_drum_1_2_5_out_wavSize },
+		{ 36, 2, 0, "in", "bass_drum_1_3_1_in_wav", &BinaryData::bass_drum_1_3_1_in_wav, BinaryData::bass_drum_1_3_1_in_wavSize },
+		{ 36, 2, 0, "out", "bass_drum_1_3_1_out_wav", &BinaryData::bass_drum_1_3_1_out_wav, BinaryData::bass_drum_1_3_1_out_wavSize },
+		{ 36, 2, 1, "in", "bass_drum_1_3_2_in_wav", &BinaryData::bass_drum_1_3_2_in_wav, BinaryData::bass_drum_1_3_2_in_wavSize },
+		{ 36, 2, 1, "out", "bass_drum_1_3_2_out_wav", &BinaryData::bass_drum_1_3_2_out_wav, BinaryData::bass_drum_1_3_2_out_wavSize },
+		{ 36, 2, 2, "in", "bass_drum_1_3_3_in_wav", &BinaryData::bass_drum_1_3_3_in_wav, BinaryData::bass_drum_1_3_3_in_wavSize },
+		{ 36, 2, 2, "out", "bass_drum_1_3_3_out_wav", &BinaryData::bass_drum_1_3_3_out_wav, BinaryData::bass_drum_1_3_3_out_wavSize },
+		{ 36, 2, 3, "in", "bass_drum_1_3_4_in_wav", &BinaryData::bass_drum_1_3_4_in_wav, BinaryData::bass_drum_1_3_4_in_wavSize },
+		{ 36, 2, 3, "out", "bass_drum_1_3_4_out_wav", &BinaryData::bass_drum_1_3_4_out_wav, BinaryData::bass_drum_1_3_4_out_wavSize },
+		{ 36, 2, 4, "in", "bass_drum_1_3_5_in_wav", &BinaryData::bass_drum_1_3_5_in_wav, BinaryData::bass_drum_1_3_5_in_wavSize },
+		{ 36, 2, 4, "out", "bass_drum_1_3_5_out_wav", &BinaryData::bass_drum_1_3_5_out_wav, BinaryData::bass_drum_1_3_5_out_wavSize },
+		{ 37, 0, 0, "", "side_stick_1_1_wav", &BinaryData::side_stick_1_1_wav, BinaryData::side_stick_1_1_wavSize },
+		{ 37, 0, 1, "", "side_stick_1_2_wav", &BinaryData::side_stick_1_2_wav, BinaryData::side_stick_1_2_wavSize },
+		{ 37, 0, 2, "", "side_stick_1_3_wav", &BinaryData::side_stick_1_3_wav, BinaryData::side_stick_1_3_wavSize },
+		{ 37, 0, 3, "", "side_stick_1_4_wav", &BinaryData::side_stick_1_4_wav, BinaryData::side_stick_1_4_wavSize },
+		{ 37, 0, 4, "", "side_stick_1_5_wav", &BinaryData::side_stick_1_5_wav, BinaryData::side_stick_1_5_wavSize },
+		{ 37, 1, 0, "", "side_stick_2_1_wav", &BinaryData::side_stick_2_1_wav, BinaryData::side_stick_2_1_wavSize },
+		{ 37, 1, 1, "", "side_stick_2_2_wav", &BinaryData::side_stick_2_2_wav, BinaryData::side_stick_2_2_wavSize },
+		{ 37, 1, 2, "", "side_stick_2_3_wav", &BinaryData::side_stick_2_3_wav, BinaryData::side_stick_2_3_wavSize },
+		{ 37, 1, 3, "", "side_stick_2_4_wav", &BinaryData::side_stick_2_4_wav, BinaryData::side_stick_2_4_wavSize },
+		{ 37, 1, 4, "", "side_stick_2_5_wav", &BinaryData::side_stick_2_5_wav, BinaryData::side_stick_2_5_wavSize },
+		{ 37, 2, 0, "", "side_stick_3_1_wav", &BinaryData::side_stick_3_1_wav, BinaryData::side_stick_3_1_wavSize },
+		{ 37, 2, 1, "", "side_stick_3_2_wav", &BinaryData::side_stick_3_2_wav, BinaryData::side_stick_3_2_wavSize },
+		{ 37, 2, 2, "", "side_stick_3_3_wav", &BinaryData::side_stick_3_3_wav, BinaryData::side_stick_3_3_wavSize },
+		{ 37, 2, 3, "", "side_stick_3_4_wav", &BinaryData::side_stick_3_4_wav, BinaryData::side_stick_3_4_wavSize },
+		{ 37, 2, 4, "", "side_stick_3_5_wav", &BinaryData::side_stick_3_5_wav, BinaryData::side_stick_3_5_wavSize },
+		{ 38, 0, 0, "bottom", "acoustic_snare_1_1_bottom_wav", &BinaryData::acoustic_snare_1_1_bottom_wav, BinaryData::acoustic_snare_1_1_bottom_wavSize },
+		{ 38, 0, 0, "top", "acoustic_snare_1_1_top_wav", &BinaryData::acoustic_snare_1_1_top_wav, BinaryData::acoustic_snare_1_1_top_wavSize },
+		{ 38, 0, 1, "bottom", "acoustic_snare_1_2_bottom_wav", &BinaryData::acoustic_snare_1_2_bottom_wav, BinaryData::acoustic_snare_1_2_bottom_wavSize },
+		{ 38, 0, 1, "top", "acoustic_snare_1_2_top_wav", &BinaryData::acoustic_snare_1_2_top_wav, BinaryData::acoustic_snare_1_2_top_wavSize },
+		{ 38, 0, 2, "bottom", "acoustic_snare_1_3_bottom_wav", &BinaryData::acoustic_snare_1_3_bottom_wav, BinaryData::acoustic_snare_1_3_bottom_wavSize },
+		{ 38, 0, 2, "top", "acoustic_snare_1_3_top_wav", &BinaryData::acoustic_snare_1_3_top_wav, BinaryData::acoustic_snare_1_3_top_wavSize },
+		{ 38, 0, 3, "bottom", "acoustic_snare_1_4_bottom_wav", &BinaryData::acoustic_snare_1_4_bottom_wav, BinaryData::acoustic_snare_1_4_bottom_wavSize },
+		{ 38, 0, 3, "top", "acoustic_snare_1_4_top_wav", &BinaryData::acoustic_snare_1_4_top_wav, BinaryData::acoustic_snare_1_4_top_wavSize },
+		{ 38, 0, 4, "bottom", "acoustic_snare_1_5_bottom_wav", &BinaryData::acoustic_snare_1_5_bottom_wav, BinaryData::acoustic_snare_1_5_bottom_wavSize },
+		{ 38, 0, 4, "top", "acoustic_snare_1_5_top_wav", &BinaryData::acoustic_snare_1_5_top_wav, BinaryData::acoustic_snare_1_5_top_wavSize },
+		{ 38, 1, 0, "bottom", "acoustic_snare_2_1_bottom_wav", &BinaryData::acoustic_snare_2_1_bottom_wav, BinaryData::acoustic_snare_2_1_bottom_wavSize },
+		{ 38, 1, 0, "top", "acoustic_snare_2_1_top_wav", &BinaryData::acoustic_snare_2_1_top_wav, BinaryData::acoustic_snare_2_1_top_wavSize },
+		{ 38, 1, 1, "bottom", "acoustic_snare_2_2_bottom_wav", &BinaryData::acoustic_snare_2_2_bottom_wav, BinaryData::acoustic_snare_2_2_bottom_wavSize },
+		{ 38, 1, 1, "top", "acoustic_snare_2_2_top_wav", &BinaryData::acoustic_snare_2_2_top_wav, BinaryData::acoustic_snare_2_2_top_wavSize },
+		{ 38, 1, 2, "bottom", "acoustic_snare_2_3_bottom_wav", &BinaryData::acoustic_snare_2_3_bottom_wav, BinaryData::acoustic_snare_2_3_bottom_wavSize },
+		{ 38, 1, 2, "top", "acoustic_snare_2_3_top_wav", &BinaryData::acoustic_snare_2_3_top_wav, BinaryData::acoustic_snare_2_3_top_wavSize },
+		{ 38, 1, 3, "bottom", "acoustic_snare_2_4_bottom_wav", &BinaryData::acoustic_snare_2_4_bottom_wav, BinaryData::acoustic_snare_2_4_bottom_wavSize },
+		{ 38, 1, 3, "top", "acoustic_snare_2_4_top_wav", &BinaryData::acoustic_snare_2_4_top_wav, BinaryData::acoustic_snare_2_4_top_wavSize },
+		{ 38, 1, 4, "bottom", "acoustic_snare_2_5_bottom_wav", &BinaryData::acoustic_snare_2_5_bottom_wav, BinaryData::acoustic_snare_2_5_bottom_wavSize },
+		{ 38, 1, 4, "top", "acoustic_snare_2_5_top_wav", &BinaryData::acoustic_snare_2_5_top_wav, BinaryData::acoustic_snare_2_5_top_wavSize },
+		{ 38, 2, 0, "bottom", "acoustic_snare_3_1_bottom_wav", &BinaryData::acoustic_snare_3_1_bottom_wav, BinaryData::acoustic_snare_3_1_bottom_wavSize },
+		{ 38, 2, 0, "top", "acoustic_snare_3_1_top_wav", &BinaryData::acoustic_snare_3_1_top_wav, BinaryData::acoustic_snare_3_1_top_wavSize },
+		{ 38, 2, 1, "bottom", "acoustic_snare_3_2_bottom_wav", &BinaryData::acoustic_snare_3_2_bottom_wav, BinaryData::acoustic_snare_3_2_bottom_wavSize },
+		{ 38, 2, 1, "top", "acoustic_snare_3_2_top_wav", &BinaryData::acoustic_snare_3_2_top_wav, BinaryData::acoustic_snare_3_2_top_wavSize },
+		{ 38, 2, 2, "bottom", "acoustic_snare_3_3_bottom_wav", &BinaryData::acoustic_snare_3_3_bottom_wav, BinaryData::acoustic_snare_3_3_bottom_wavSize },
+		{ 38, 2, 2, "top", "acoustic_snare_3_3_top_wav", &BinaryData::acoustic_snare_3_3_top_wav, BinaryData::acoustic_snare_3_3_top_wavSize },
+		{ 38, 2, 3, "bottom", "acoustic_snare_3_4_bottom_wav", &BinaryData::acoustic_snare_3_4_bottom_wav, BinaryData::acoustic_snare_3_4_bottom_wavSize },
+		{ 38, 2, 3, "top", "acoustic_snare_3_4_top_wav", &BinaryData::acoustic_snare_3_4_top_wav, BinaryData::acoustic_snare_3_4_top_wavSize },
+		{ 38, 2, 4, "bottom", "acoustic_snare_3_5_bottom_wav", &BinaryData::acoustic_snare_3_5_bottom_wav, BinaryData::acoustic_snare_3_5_bottom_wavSize },
+		{ 38, 2, 4, "top", "acoustic_snare_3_5_top_wav", &BinaryData::acoustic_snare_3_5_top_wav, BinaryData::acoustic_snare_3_5_top_wavSize },
+		{ 39, 0, 0, "", "hand_clap_1_wav", &BinaryData::hand_clap_1_wav, BinaryData::hand_clap_1_wavSize },
+		{ 39, 0, 1, "", "hand_clap_2_wav", &BinaryData::hand_clap_2_wav, BinaryData::hand_clap_2_wavSize },
+		{ 39, 0, 2, "", "hand_clap_3_wav", &BinaryData::hand_clap_3_wav, BinaryData::hand_clap_3_wavSize },
+		{ 39, 0, 3, "", "hand_clap_4_wav", &BinaryData::hand_clap_4_wav, BinaryData::hand_clap_4_wavSize },
+		{ 39, 0, 4, "", "hand_clap_5_wav", &BinaryData::hand_clap_5_wav, BinaryData::hand_clap_5_wavSize },
+		{ 40, 0, 0, "bottom", "electric_snare_1_1_bottom_wav", &BinaryData::electric_snare_1_1_bottom_wav, BinaryData::electric_snare_1_1_bottom_wavSize },
+		{ 40, 0, 0, "top", "electric_snare_1_1_top_wav", &BinaryData::electric_snare_1_1_top_wav, BinaryData::electric_snare_1_1_top_wavSize },
+		{ 40, 0, 1, "bottom", "electric_snare_1_2_bottom_wav", &BinaryData::electric_snare_1_2_bottom_wav, BinaryData::electric_snare_1_2_bottom_wavSize },
+		{ 40, 0, 1, "top", "electric_snare_1_2_top_wav", &BinaryData::electric_snare_1_2_top_wav, BinaryData::electric_snare_1_2_top_wavSize },
+		{ 40, 0, 2, "bottom", "electric_snare_1_3_bottom_wav", &BinaryData::electric_snare_1_3_bottom_wav, BinaryData::electric_snare_1_3_bottom_wavSize },
+		{ 40, 0, 2, "top", "electric_snare_1_3_top_wav", &BinaryData::electric_snare_1_3_top_wav, BinaryData::electric_snare_1_3_top_wavSize },
+		{ 40, 0, 3, "bottom", "electric_snare_1_4_bottom_wav", &BinaryData::electric_snare_1_4_bottom_wav, BinaryData::electric_snare_1_4_bottom_wavSize },
+		{ 40, 0, 3, "top", "electric_snare_1_4_top_wav", &BinaryData::electric_snare_1_4_top_wav, BinaryData::electric_snare_1_4_top_wavSize },
+		{ 40, 0, 4, "bottom", "electric_snare_1_5_bottom_wav", &BinaryData::electric_snare_1_5_bottom_wav, BinaryData::electric_snare_1_5_bottom_wavSize },
+		{ 40, 0, 4, "top", "electric_snare_1_5_top_wav", &BinaryData::electric_snare_1_5_top_wav, BinaryData::electric_snare_1_5_top_wavSize },
+		{ 40, 1, 0, "bottom", "electric_snare_2_1_bottom_wav", &BinaryData::electric_snare_2_1_bottom_wav, BinaryData::electric_snare_2_1_bottom_wavSize },
+		{ 40, 1, 0, "top", "electric_snare_2_1_top_wav", &BinaryData::electric_snare_2_1_top_wav, BinaryData::electric_snare_2_1_top_wavSize },
+		{ 40, 1, 1, "bottom", "electric_snare_2_2_bottom_wav", &BinaryData::electric_snare_2_2_bottom_wav, BinaryData::electric_snare_2_2_bottom_wavSize },
+		{ 40, 1, 1, "top", "electric_snare_2_2_top_wav", &BinaryData::electric_snare_2_2_top_wav, BinaryData::electric_snare_2_2_top_wavSize },
+		{ 40, 1, 2, "bottom", "electric_snare_2_3_bottom_wav", &BinaryData::electric_snare_2_3_bottom_wav, BinaryData::electric_snare_2_3_bottom_wavSize },
+		{ 40, 1, 2, "top", "electric_snare_2_3_top_wav", &BinaryData::electric_snare_2_3_top_wav, BinaryData::electric_snare_2_3_top_wavSize },
+		{ 40, 1, 3, "bottom", "electric_snare_2_4_bottom_wav", &BinaryData::electric_snare_2_4_bottom_wav, BinaryData::electric_snare_2_4_bottom_wavSize },
+		{ 40, 1, 3, "top", "electric_snare_2_4_top_wav", &BinaryData::electric_snare_2_4_top_wav, BinaryData::electric_snare_2_4_top_wavSize },
+		{ 40, 1, 4, "bottom", "electric_snare_2_5_bottom_wav", &BinaryData::electric_snare_2_5_bottom_wav, BinaryData::electric_snare_2_5_bottom_wavSize },
+		{ 40, 1, 4, "top", "electric_snare_2_5_top_wav", &BinaryData::electric_snare_2_5_top_wav, BinaryData::electric_snare_2_5_top_wavSize },
+		{ 40, 2, 0, "bottom", "electric_snare_3_1_bottom_wav", &BinaryData::electric_snare_3_1_bottom_wav, BinaryData::electric_snare_3_1_bottom_wavSize },
+		{ 40, 2, 0, "top", "electric_snare_3_1_top_wav", &BinaryData::electric_snare_3_1_top_wav, BinaryData::electric_snare_3_1_top_wavSize },
+		{ 40, 2, 1, "bottom", "electric_snare_3_2_bottom_wav", &BinaryData::electric_snare_3_2_bottom_wav, BinaryData::electric_snare_3_2_bottom_wavSize },
+		{ 40, 2, 1, "top", "electric_snare_3_2_top_wav", &BinaryData::electric_snare_3_2_top_wav, BinaryData::electric_snare_3_2_top_wavSize },
+		{ 40, 2, 2, "bottom", "electric_snare_3_3_bottom_wav", &BinaryData::electric_snare_3_3_bottom_wav, BinaryData::electric_snare_3_3_bottom_wavSize },
+		{ 40, 2, 2, "top", "electric_snare_3_3_top_wav", &BinaryData::electric_snare_3_3_top_wav, BinaryData::electric_snare_3_3_top_wavSize },
+		{ 40, 2, 3, "bottom", "electric_snare_3_4_bottom_wav", &BinaryData::electric_snare_3_4_bottom_wav, BinaryData::electric_snare_3_4_bottom_wavSize },
+		{ 40, 2, 3, "top", "electric_snare_3_4_top_wav", &BinaryData::electric_snare_3_4_top_wav, BinaryData::electric_snare_3_4_top_wavSize },
+		{ 40, 2, 4, "bottom", "electric_snare_3_5_bottom_wav", &BinaryData::electric_snare_3_5_bottom_wav, BinaryData::electric_snare_3_5_bottom_wavSize },
+		{ 40, 2, 4, "top", "electric_snare_3_5_top_wav", &BinaryData::electric_snare_3_5_top_wav, BinaryData::electric_snare_3_5_top_wavSize },
+		{ 42, 0, 0, "", "closed_hi_hat_1_1_wav", &BinaryData::closed_hi_hat_1_1_wav, BinaryData::closed_hi_hat_1_1_wavSize },
+		{ 42, 0, 0, "left", "closed_hi_hat_1_1_left_wav", &BinaryData::closed_hi_hat_1_1_left_wav, BinaryData::closed_hi_hat_1_1_left_wavSize },
+		{ 42, 0, 0, "right", "closed_hi_hat_1_1_right_wav", &BinaryData::closed_hi_hat_1_1_right_wav, BinaryData::closed_hi_hat_1_1_right_wavSize },
+		{ 42, 0, 1, "", "closed_hi_hat_1_2_wav", &BinaryData::closed_hi_hat_1_2_wav, BinaryData::closed_hi_hat_1_2_wavSize },
+		{ 42, 0, 1, "left", "closed_hi_hat_1_2_left_wav", &BinaryData::closed_hi_hat_1_2_left_wav, BinaryData::closed_hi_hat_1_2_left_wavSize },
+		{ 42, 0, 1, "right", "closed_hi_hat_1_2_right_wav", &BinaryData::closed_hi_hat_1_2_right_wav, BinaryData::closed_hi_hat_1_2_right_wavSize },
+		{ 42, 0, 2, "", "closed_hi_hat_1_3_wav", &BinaryData::closed_hi_hat_1_3_wav, BinaryData::closed_hi_hat_1_3_wavSize },
+		{ 42, 0, 2, "left", "closed_hi_hat_1_3_left_wav", &BinaryData::closed_hi_hat_1_3_left_wav, BinaryData::closed_hi_hat_1_3_left_wavSize },
+		{ 42, 0, 2, "right", "closed_hi_hat_1_3_right_wav", &BinaryData::closed_hi_hat_1_3_right_wav, BinaryData::closed_hi_hat_1_3_right_wavSize },
+		{ 42, 0, 3, "", "closed_hi_hat_1_4_wav", &BinaryData::closed_hi_hat_1_4_wav, BinaryData::closed_hi_hat_1_4_wavSize },
+		{ 42, 0, 3, "left", "closed_hi_hat_1_4_left_wav", &BinaryData::closed_hi_hat_1_4_left_wav, BinaryData::closed_hi_hat_1_4_left_wavSize },
+		{ 42, 0, 3, "right", "closed_hi_hat_1_4_right_wav", &BinaryData::closed_hi_hat_1_4_right_wav, BinaryData::closed_hi_hat_1_4_right_wavSize },
+		{ 42, 0, 4, "", "closed_hi_hat_1_5_wav", &BinaryData::closed_hi_hat_1_5_wav, BinaryData::closed_hi_hat_1_5_wavSize },
+		{ 42, 0, 4, "left", "closed_hi_hat_1_5_left_wav", &BinaryData::closed_hi_hat_1_5_left_wav, BinaryData::closed_hi_hat_1_5_left_wavSize },
+		{ 42, 0, 4, "right", "closed_hi_hat_1_5_right_wav", &BinaryData::closed_hi_hat_1_5_right_wav, BinaryData::closed_hi_hat_1_5_right_wavSize },
+		{ 42, 1, 0, "", "closed_hi_hat_2_1_wav", &BinaryData::closed_hi_hat_2_1_wav, BinaryData::closed_hi_hat_2_1_wavSize },
+		{ 42, 1, 0, "left", "closed_hi_hat_2_1_left_wav", &BinaryData::closed_hi_hat_2_1_left_wav, BinaryData::closed_hi_hat_2_1_left_wavSize },
+		{ 42, 1, 0, "right", "closed_hi_hat_2_1_right_wav", &BinaryData::closed_hi_hat_2_1_right_wav, BinaryData::closed_hi_hat_2_1_right_wavSize },
+		{ 42, 1, 1, "", "closed_hi_hat_2_2_wav", &BinaryData::closed_hi_hat_2_2_wav, BinaryData::closed_hi_hat_2_2_wavSize },
+		{ 42, 1, 1, "left", "closed_hi_hat_2_2_left_wav", &BinaryData::closed_hi_hat_2_2_left_wav, BinaryData::closed_hi_hat_2_2_left_wavSize },
+		{ 42, 1, 1, "right", "closed_hi_hat_2_2_right_wav", &BinaryData::closed_hi_hat_2_2_right_wav, BinaryData::closed_hi_hat_2_2_right_wavSize },
+		{ 42, 1, 2, "", "closed_hi_hat_2_3_wav", &BinaryData::closed_hi_hat_2_3_wav, BinaryData::closed_hi_hat_2_3_wavSize },
+		{ 42, 1, 2, "left", "closed_hi_hat_2_3_left_wav", &BinaryData::closed_hi_hat_2_3_left_wav, BinaryData::closed_hi_hat_2_3_left_wavSize },
+		{ 42, 1, 2, "right", "closed_hi_hat_2_3_right_wav", &BinaryData::closed_hi_hat_2_3_right_wav, BinaryData::closed_hi_hat_2_3_right_wavSize },
+		{ 42, 1, 3, "", "closed_hi_hat_2_4_wav", &BinaryData::closed_hi_hat_2_4_wav, BinaryData::closed_hi_hat_2_4_wavSize },
+		{ 42, 1, 3, "left", "closed_hi_hat_2_4_left_wav", &BinaryData::closed_hi_hat_2_4_left_wav, BinaryData::closed_hi_hat_2_4_left_wavSize },
+		{ 42, 1, 3, "right", "closed_hi_hat_2_4_right_wav", &BinaryData::closed_hi_hat_2_4_right_wav, BinaryData::closed_hi_hat_2_4_right_wavSize },
+		{ 42, 1, 4, "", "closed_hi_hat_2_5_wav", &BinaryData::closed_hi_hat_2_5_wav, BinaryData::closed_hi_hat_2_5_wavSize },
+		{ 42, 1, 4, "left", "closed_hi_hat_2_5_left_wav", &BinaryData::closed_hi_hat_2_5_left_wav, BinaryData::closed_hi_hat_2_5_left_wavSize },
+		{ 42, 1, 4, "right", "closed_hi_hat_2_5_right_wav", &BinaryData::closed_hi_hat_2_5_right_wav, BinaryData::closed_hi_hat_2_5_right_wavSize },
+		{ 43, 0, 0, "", "high_floor_tom_1_1_wav", &BinaryData::high_floor_tom_1_1_wav, BinaryData::high_floor_tom_1_1_wavSize },
+		{ 43, 0, 1, "", "high_floor_tom_1_2_wav", &BinaryData::high_floor_tom_1_2_wav, BinaryData::high_floor_tom_1_2_wavSize },
+		{ 43, 0, 2, "", "high_floor_tom_1_3_wav", &BinaryData::high_floor_tom_1_3_wav, BinaryData::high_floor_tom_1_3_wavSize },
+		{ 43, 0, 3, "", "high_floor_tom_1_4_wav", &BinaryData::high_floor_tom_1_4_wav, BinaryData::high_floor_tom_1_4_wavSize },
+		{ 43, 0, 4, "", "high_floor_tom_1_5_wav", &BinaryData::high_floor_tom_1_5_wav, BinaryData::high_floor_tom_1_5_wavSize },
+		{ 43, 1, 0, "", "high_floor_tom_2_1_wav", &BinaryData::high_floor_tom_2_1_wav, BinaryData::high_floor_tom_2_1_wavSize },
+		{ 43, 1, 1, "", "high_floor_tom_2_2_wav", &BinaryData::high_floor_tom_2_2_wav, BinaryData::high_floor_tom_2_2_wavSize },
+		{ 43, 1, 2, "", "high_floor_tom_2_3_wav", &BinaryData::high_floor_tom_2_3_wav, BinaryData::high_floor_tom_2_3_wavSize },
+		{ 43, 1, 3, "", "high_floor_tom_2_4_wav", &BinaryData::high_floor_tom_2_4_wav, BinaryData::high_floor_tom_2_4_wavSize },
+		{ 43, 1, 4, "", "high_floor_tom_2_5_wav", &BinaryData::high_floor_tom_2_5_wav, BinaryData::high_floor_tom_2_5_wavSize },
+		{ 43, 2, 0, "", "high_floor_tom_3_1_wav", &BinaryData::high_floor_tom_3_1_wav, BinaryData::high_floor_tom_3_1_wavSize },
+		{ 43, 2, 1, "", "high_floor_tom_3_2_wav", &BinaryData::high_floor_tom_3_2_wav, BinaryData::high_floor_tom_3_2_wavSize },
+		{ 43, 2, 2, "", "high_floor_tom_3_3_wav", &BinaryData::high_floor_tom_3_3_wav, BinaryData::high_floor_tom_3_3_wavSize },
+		{ 43, 2, 3, "", "high_floor_tom_3_4_wav", &BinaryData::high_floor_tom_3_4_wav, BinaryData::high_floor_tom_3_4_wavSize },
+		{ 43, 2, 4, "", "high_floor_tom_3_5_wav", &BinaryData::high_floor_tom_3_5_wav, BinaryData::high_floor_tom_3_5_wavSize },
+		{ 44, 0, 0, "", "pedal_hi_hat_1_wav", &BinaryData::pedal_hi_hat_1_wav, BinaryData::pedal_hi_hat_1_wavSize },
+		{ 44, 0, 0, "left", "pedal_hi_hat_1_left_wav", &BinaryData::pedal_hi_hat_1_left_wav, BinaryData::pedal_hi_hat_1_left_wavSize },
+		{ 44, 0, 0, "right", "pedal_hi_hat_1_right_wav", &BinaryData::pedal_hi_hat_1_right_wav, BinaryData::pedal_hi_hat_1_right_wavSize },
+		{ 44, 0, 1, "", "pedal_hi_hat_2_wav", &BinaryData::pedal_hi_hat_2_wav, BinaryData::pedal_hi_hat_2_wavSize },
+		{ 44, 0, 1, "left", "pedal_hi_hat_2_left_wav", &BinaryData::pedal_hi_hat_2_left_wav, BinaryData::pedal_hi_hat_2_left_wavSize },
+		{ 44, 0, 1, "right", "pedal_hi_hat_2_right_wav", &BinaryData::pedal_hi_hat_2_right_wav, BinaryData::pedal_hi_hat_2_right_wavSize },
+		{ 44, 0, 2, "", "pedal_hi_hat_3_wav", &BinaryData::pedal_hi_hat_3_wav, BinaryData::pedal_hi_hat_3_wavSize },
+		{ 44, 0, 2, "left", "pedal_hi_hat_3_left_wav", &BinaryData::pedal_hi_hat_3_left_wav, BinaryData::pedal_hi_hat_3_left_wavSize },
+		{ 44, 0, 2, "right", "pedal_hi_hat_3_right_wav", &BinaryData::pedal_hi_hat_3_right_wav, BinaryData::pedal_hi_hat_3_right_wavSize },
+		{ 44, 0, 3, "", "pedal_hi_hat_4_wav", &BinaryData::pedal_hi_hat_4_wav, BinaryData::pedal_hi_hat_4_wavSize },
+		{ 44, 0, 3, "left", "pedal_hi_hat_4_left_wav", &BinaryData::pedal_hi_hat_4_left_wav, BinaryData::pedal_hi_hat_4_left_wavSize },
+		{ 44, 0, 3, "right", "pedal_hi_hat_4_right_wav", &BinaryData::pedal_hi_hat_4_right_wav, BinaryData::pedal_hi_hat_4_right_wavSize },
+		{ 44, 0, 4, "", "pedal_hi_hat_5_wav", &BinaryData::pedal_hi_hat_5_wav, BinaryData::pedal_hi_hat_5_wavSize },
+		{ 44, 0, 4, "left", "pedal_hi_hat_5_left_wav", &BinaryData::pedal_hi_hat_5_left_wav, BinaryData::pedal_hi_hat_5_left_wavSize },
+		{ 44, 0, 4, "right", "pedal_hi_hat_5_right_wav", &BinaryData::pedal_hi_hat_5_right_wav, BinaryData::pedal_hi_hat_5_right_wavSize },
+		{ 46, 0, 0, "", "open_hi_hat_1_1_wav", &BinaryData::open_hi_hat_1_1_wav, BinaryData::open_hi_hat_1_1_wavSize },
+		{ 46, 0, 0, "left", "open_hi_hat_1_1_left_wav", &BinaryData::open_hi_hat_1_1_left_wav, BinaryData::open_hi_hat_1_1_left_wavSize },
+		{ 46, 0, 0, "right", "open_hi_hat_1_1_right_wav", &BinaryData::open_hi_hat_1_1_right_wav, BinaryData::open_hi_hat_1_1_right_wavSize },
+		{ 46, 0, 1, "", "open_hi_hat_1_2_wav", &BinaryData::open_hi_hat_1_2_wav, BinaryData::open_hi_hat_1_2_wavSize },
+		{ 46, 0, 1, "left", "open_hi_hat_1_2_left_wav", &BinaryData::open_hi_hat_1_2_left_wav, BinaryData::open_hi_hat_1_2_left_wavSize },
+		{ 46, 0, 1, "right", "open_hi_hat_1_2_right_wav", &BinaryData::open_hi_hat_1_2_right_wav, BinaryData::open_hi_hat_1_2_right_wavSize },
+		{ 46, 0, 2, "", "open_hi_hat_1_3_wav", &BinaryData::open_hi_hat_1_3_wav, BinaryData::open_hi_hat_1_3_wavSize },
+		{ 46, 0, 2, "left", "open_hi_hat_1_3_left_wav", &BinaryData::open_hi_hat_1_3_left_wav, BinaryData::open_hi_hat_1_3_left_wavSize },
+		{ 46, 0, 2, "right", "open_hi_hat_1_3_right_wav", &BinaryData::open_hi_hat_1_3_right_wav, BinaryData::open_hi_hat_1_3_right_wavSize },
+		{ 46, 0, 3, "", "open_hi_hat_1_4_wav", &BinaryData::open_hi_hat_1_4_wav, BinaryData::open_hi_hat_1_4_wavSize },
+		{ 46, 0, 3, "left", "open_hi_hat_1_4_left_wav", &BinaryData::open_hi_hat_1_4_left_wav, BinaryData::open_hi_hat_1_4_left_wavSize },
+		{ 46, 0, 3, "right", "open_hi_hat_1_4_right_wav", &BinaryData::open_hi_hat_1_4_right_wav, BinaryData::open_hi_hat_1_4_right_wavSize },
+		{ 46, 0, 4, "", "open_hi_hat_1_5_wav", &BinaryData::open_hi_hat_1_5_wav, BinaryData::open_hi_hat_1_5_wavSize },
+		{ 46, 0, 4, "left", "open_hi_hat_1_5_left_wav", &BinaryData::open_hi_hat_1_5_left_wav, BinaryData::open_hi_hat_1_5_left_wavSize },
+		{ 46, 0, 4, "right", "open_hi_hat_1_5_right_wav", &BinaryData::open_hi_hat_1_5_right_wav, BinaryData::open_hi_hat_1_5_right_wavSize },
+		{ 46, 1, 0, "", "open_hi_hat_2_1_wav", &BinaryData::open_hi_hat_2_1_wav, BinaryData::open_hi_hat_2_1_wavSize },
+		{ 46, 1, 0, "left", "open_hi_hat_2_1_left_wav", &BinaryData::open_hi_hat_2_1_left_wav, BinaryData::open_hi_hat_2_1_left_wavSize },
+		{ 46, 1, 0, "right", "open_hi_hat_2_1_right_wav", &BinaryData::open_hi_hat_2_1_right_wav, BinaryData::open_hi_hat_2_1_right_wavSize },
+		{ 46, 1, 1, "", "open_hi_hat_2_2_wav", &BinaryData::open_hi_hat_2_2_wav, BinaryData::open_hi_hat_2_2_wavSize },
+		{ 46, 1, 1, "left", "open_hi_hat_2_2_left_wav", &BinaryData::open_hi_hat_2_2_left_wav, BinaryData::open_hi_hat_2_2_left_wavSize },
+		{ 46, 1, 1, "right", "open_hi_hat_2_2_right_wav", &BinaryData::open_hi_hat_2_2_right_wav, BinaryData::open_hi_hat_2_2_right_wavSize },
+		{ 46, 1, 2, "", "open_hi_hat_2_3_wav", &BinaryData::open_hi_hat_2_3_wav, BinaryData::open_hi_hat_2_3_wavSize },
+		{ 46, 1, 2, "left", "open_hi_hat_2_3_left_wav", &BinaryData::open_hi_hat_2_3_left_wav, BinaryData::open_hi_hat_2_3_left_wavSize },
+		{ 46, 1, 2, "right", "open_hi_hat_2_3_right_wav", &BinaryData::open_hi_hat_2_3_right_wav, BinaryData::open_hi_hat_2_3_right_wavSize },
+		{ 46, 1, 3, "", "open_hi_hat_2_4_wav", &BinaryData::open_hi_hat_2_4_wav, BinaryData::open_hi_hat_2_4_wavSize },
+		{ 46, 1, 3, "left", "open_hi_hat_2_4_left_wav", &BinaryData::open_hi_hat_2_4_left_wav, BinaryData::open_hi_hat_2_4_left_wavSize },
+		{ 46, 1, 3, "right", "open_hi_hat_2_4_right_wav", &BinaryData::open_hi_hat_2_4_right_wav, BinaryData::open_hi_hat_2_4_right_wavSize },
+		{ 46, 1, 4, "", "open_hi_hat_2_5_wav", &BinaryData::open_hi_hat_2_5_wav, BinaryData::open_hi_hat_2_5_wavSize },
+		{ 46, 1, 4, "left", "open_hi_hat_2_5_left_wav", &BinaryData::open_hi_hat_2_5_left_wav, BinaryData::open_hi_hat_2_5_left_wavSize },
+		{ 46, 1, 4, "right", "open_hi_hat_2_5_right_wav", &BinaryData::open_hi_hat_2_5_right_wav, BinaryData::open_hi_hat_2_5_right_wavSize },
+		{ 46, 2, 0, "", "open_hi_hat_3_1_wav", &BinaryData::open_hi_hat_3_1_wav, BinaryData::open_hi_hat_3_1_wavSize },
+		{ 46, 2, 0, "left", "open_hi_hat_3_1_left_wav", &BinaryData::open_hi_hat_3_1_left_wav, BinaryData::open_hi_hat_3_1_left_wavSize },
+		{ 46, 2, 0, "right", "open_hi_hat_3_1_right_wav", &BinaryData::open_hi_hat_3_1_right_wav, BinaryData::open_hi_hat_3_1_right_wavSize },
+		{ 46, 2, 1, "", "open_hi_hat_3_2_wav", &BinaryData::open_hi_hat_3_2_wav, BinaryData::open_hi_hat_3_2_wavSize },
+		{ 46, 2, 1, "left", "open_hi_hat_3_2_left_wav", &BinaryData::open_hi_hat_3_2_left_wav, BinaryData::open_hi_hat_3_2_left_wavSize },
+		{ 46, 2, 1, "right", "open_hi_hat_3_2_right_wav", &BinaryData::open_hi_hat_3_2_right_wav, BinaryData::open_hi_hat_3_2_right_wavSize },
+		{ 46, 2, 2, "", "open_hi_hat_3_3_wav", &BinaryData::open_hi_hat_3_3_wav, BinaryData::open_hi_hat_3_3_wavSize },
+		{ 46, 2, 2, "left", "open_hi_hat_3_3_left_wav", &BinaryData::open_hi_hat_3_3_left_wav, BinaryData::open_hi_hat_3_3_left_wavSize },
+		{ 46, 2, 2, "right", "open_hi_hat_3_3_right_wav", &BinaryData::open_hi_hat_3_3_right_wav, BinaryData::open_hi_hat_3_3_right_wavSize },
+		{ 46, 2, 3, "", "open_hi_hat_3_4_wav", &BinaryData::open_hi_hat_3_4_wav, BinaryData::open_hi_hat_3_4_wavSize },
+		{ 46, 2, 3, "left", "open_hi_hat_3_4_left_wav", &BinaryData::open_hi_hat_3_4_left_wav, BinaryData::open_hi_hat_3_4_left_wavSize },
+		{ 46, 2, 3, "right", "open_hi_hat_3_4_right_wav", &BinaryData::open_hi_hat_3_4_right_wav, BinaryData::open_hi_hat_3_4_right_wavSize },
+		{ 46, 2, 4, "", "open_hi_hat_3_5_wav", &BinaryData::open_hi_hat_3_5_wav, BinaryData::open_hi_hat_3_5_wavSize },
+		{ 46, 2, 4, "left", "open_hi_hat_3_5_left_wav", &BinaryData::open_hi_hat_3_5_left_wav, BinaryData::open_hi_hat_3_5_left_wavSize },
+		{ 46, 2, 4, "right", "open_hi_hat_3_5_right_wav", &BinaryData::open_hi_hat_3_5_right_wav, BinaryData::open_hi_hat_3_5_right_wavSize },
+		{ 46, 3, 0, "", "open_hi_hat_4_1_wav", &BinaryData::open_hi_hat_4_1_wav, BinaryData::open_hi_hat_4_1_wavSize },
+		{ 46, 3, 0, "left", "open_hi_hat_4_1_left_wav", &BinaryData::open_hi_hat_4_1_left_wav, BinaryData::open_hi_hat_4_1_left_wavSize },
+		{ 46, 3, 0, "right", "open_hi_hat_4_1_right_wav", &BinaryData::open_hi_hat_4_1_right_wav, BinaryData::open_hi_hat_4_1_right_wavSize },
+		{ 46, 3, 1, "", "open_hi_hat_4_2_wav", &BinaryData::open_hi_hat_4_2_wav, BinaryData::open_hi_hat_4_2_wavSize },
+		{ 46, 3, 1, "left", "open_hi_hat_4_2_left_wav", &BinaryData::open_hi_hat_4_2_left_wav, BinaryData::open_hi_hat_4_2_left_wavSize },
+		{ 46, 3, 1, "right", "open_hi_hat_4_2_right_wav", &BinaryData::open_hi_hat_4_2_right_wav, BinaryData::open_hi_hat_4_2_right_wavSize },
+		{ 46, 3, 2, "", "open_hi_hat_4_3_wav", &BinaryData::open_hi_hat_4_3_wav, BinaryData::open_hi_hat_4_3_wavSize },
+		{ 46, 3, 2, "left", "open_hi_hat_4_3_left_wav", &BinaryData::open_hi_hat_4_3_left_wav, BinaryData::open_hi_hat_4_3_left_wavSize },
+		{ 46, 3, 2, "right", "open_hi_hat_4_3_right_wav", &BinaryData::open_hi_hat_4_3_right_wav, BinaryData::open_hi_hat_4_3_right_wavSize },
+		{ 46, 3, 3, "", "open_hi_hat_4_4_wav", &BinaryData::open_hi_hat_4_4_wav, BinaryData::open_hi_hat_4_4_wavSize },
+		{ 46, 3, 3, "left", "open_hi_hat_4_4_left_wav", &BinaryData::open_hi_hat_4_4_left_wav, BinaryData::open_hi_hat_4_4_left_wavSize },
+		{ 46, 3, 3, "right", "open_hi_hat_4_4_right_wav", &BinaryData::open_hi_hat_4_4_right_wav, BinaryData::open_hi_hat_4_4_right_wavSize },
+		{ 46, 3, 4, "", "open_hi_hat_4_5_wav", &BinaryData::open_hi_hat_4_5_wav, BinaryData::open_hi_hat_4_5_wavSize },
+		{ 46, 3, 4, "left", "open_hi_hat_4_5_left_wav", &BinaryData::open_hi_hat_4_5_left_wav, BinaryData::open_hi_hat_4_5_left_wavSize },
+		{ 46, 3, 4, "right", "open_hi_hat_4_5_right_wav", &BinaryData::open_hi_hat_4_5_right_wav, BinaryData::open_hi_hat_4_5_right_wavSize },
+		{ 46, 4, 0, "", "open_hi_hat_5_1_wav", &BinaryData::open_hi_hat_5_1_wav, BinaryData::open_hi_hat_5_1_wavSize },
+		{ 46, 4, 0, "left", "open_hi_hat_5_1_left_wav", &BinaryData::open_hi_hat_5_1_left_wav, BinaryData::open_hi_hat_5_1_left_wavSize },
+		{ 46, 4, 0, "right", "open_hi_hat_5_1_right_wav", &BinaryData::open_hi_hat_5_1_right_wav, BinaryData::open_hi_hat_5_1_right_wavSize },
+		{ 46, 4, 1, "", "open_hi_hat_5_2_wav", &BinaryData::open_hi_hat_5_2_wav, BinaryData::open_hi_hat_5_2_wavSize },
+		{ 46, 4, 1, "left", "open_hi_hat_5_2_left_wav", &BinaryData::open_hi_hat_5_2_left_wav, BinaryData::open_hi_hat_5_2_left_wavSize },
+		{ 46, 4, 1, "right", "open_hi_hat_5_2_right_wav", &BinaryData::open_hi_hat_5_2_right_wav, BinaryData::open_hi_hat_5_2_right_wavSize },
+		{ 46, 4, 2, "", "open_hi_hat_5_3_wav", &BinaryData::open_hi_hat_5_3_wav, BinaryData::open_hi_hat_5_3_wavSize },
+		{ 46, 4, 2, "left", "open_hi_hat_5_3_left_wav", &BinaryData::open_hi_hat_5_3_left_wav, BinaryData::open_hi_hat_5_3_left_wavSize },
+		{ 46, 4, 2, "right", "open_hi_hat_5_3_right_wav", &BinaryData::open_hi_hat_5_3_right_wav, BinaryData::open_hi_hat_5_3_right_wavSize },
+		{ 46, 4, 3, "", "open_hi_hat_5_4_wav", &BinaryData::open_hi_hat_5_4_wav, BinaryData::open_hi_hat_5_4_wavSize },
+		{ 46, 4, 3, "left", "open_hi_hat_5_4_left_wav", &BinaryData::open_hi_hat_5_4_left_wav, BinaryData::open_hi_hat_5_4_left_wavSize },
+		{ 46, 4, 3, "right", "open_hi_hat_5_4_right_wav", &BinaryData::open_hi_hat_5_4_right_wav, BinaryData::open_hi_hat_5_4_right_wavSize },
+		{ 46, 4, 4, "", "open_hi_hat_5_5_wav", &BinaryData::open_hi_hat_5_5_wav, BinaryData::open_hi_hat_5_5_wavSize },
+		{ 46, 4, 4, "left", "open_hi_hat_5_5_left_wav", &BinaryData::open_hi_hat_5_5_left_wav, BinaryData::open_hi_hat_5_5_left_wavSize },
+		{ 46, 4, 4, "right", "open_hi_hat_5_5_right_wav", &BinaryData::open_hi_hat_5_5_right_wav, BinaryData::open_hi_hat_5_5_right_wavSize },
+		{ 49, 0, 0, "", "crash_cymbal_1_1_wav", &BinaryData::crash_cymbal_1_1_wav, BinaryData::crash_cymbal_1_1_wavSize },
+		{ 49, 0, 0, "left", "crash_cymbal_1_1_left_wav", &BinaryData::crash_cymbal_1_1_left_wav, BinaryData::crash_cymbal_1_1_left_wavSize },
+		{ 49, 0, 0, "right", "crash_cymbal_1_1_right_wav", &BinaryData::crash_cymbal_1_1_right_wav, BinaryData::crash_cymbal_1_1_right_wavSize },
+		{ 49, 0, 1, "", "crash_cymbal_1_2_wav", &BinaryData::crash_cymbal_1_2_wav, BinaryData::crash_cymbal_1_2_wavSize },
+		{ 49, 0, 1, "left", "crash_cymbal_1_2_left_wav", &BinaryData::crash_cymbal_1_2_left_wav, BinaryData::crash_cymbal_1_2_left_wavSize },
+		{ 49, 0, 1, "right", "crash_cymbal_1_2_right_wav", &BinaryData::crash_cymbal_1_2_right_wav, BinaryData::crash_cymbal_1_2_right_wavSize },
+		{ 49, 0, 2, "", "crash_cymbal_1_3_wav", &BinaryData::crash_cymbal_1_3_wav, BinaryData::crash_cymbal_1_3_wavSize },
+		{ 49, 0, 2, "left", "crash_cymbal_1_3_left_wav", &BinaryData::crash_cymbal_1_3_left_wav, BinaryData::crash_cymbal_1_3_left_wavSize },
+		{ 49, 0, 2, "right", "crash_cymbal_1_3_right_wav", &BinaryData::crash_cymbal_1_3_right_wav, BinaryData::crash_cymbal_1_3_right_wavSize },
+		{ 49, 0, 3, "", "crash_cymbal_1_4_wav", &BinaryData::crash_cymbal_1_4_wav, BinaryData::crash_cymbal_1_4_wavSize },
+		{ 49, 0, 3, "left", "crash_cymbal_1_4_left_wav", &BinaryData::crash_cymbal_1_4_left_wav, BinaryData::crash_cymbal_1_4_left_wavSize },
+		{ 49, 0, 3, "right", "crash_cymbal_1_4_right_wav", &BinaryData::crash_cymbal_1_4_right_wav, BinaryData::crash_cymbal_1_4_right_wavSize },
+		{ 49, 0, 4, "", "crash_cymbal_1_5_wav", &BinaryData::crash_cymbal_1_5_wav, BinaryData::crash_cymbal_1_5_wavSize },
+		{ 49, 0, 4, "left", "crash_cymbal_1_5_left_wav", &BinaryData::crash_cymbal_1_5_left_wav, BinaryData::crash_cymbal_1_5_left_wavSize },
+		{ 49, 0, 4, "right", "crash_cymbal_1_5_right_wav", &BinaryData::crash_cymbal_1_5_right_wav, BinaryData::crash_cymbal_1_5_right_wavSize },
+		{ 50, 0, 0, "", "high_tom_1_1_wav", &BinaryData::high_tom_1_1_wav, BinaryData::high_tom_1_1_wavSize },
+		{ 50, 0, 1, "", "high_tom_1_2_wav", &BinaryData::high_tom_1_2_wav, BinaryData::high_tom_1_2_wavSize },
+		{ 50, 0, 2, "", "high_tom_1_3_wav", &BinaryData::high_tom_1_3_wav, BinaryData::high_tom_1_3_wavSize },
+		{ 50, 0, 3, "", "high_tom_1_4_wav", &BinaryData::high_tom_1_4_wav, BinaryData::high_tom_1_4_wavSize },
+		{ 50, 0, 4, "", "high_tom_1_5_wav", &BinaryData::high_tom_1_5_wav, BinaryData::high_tom_1_5_wavSize },
+		{ 50, 1, 0, "", "high_tom_2_1_wav", &BinaryData::high_tom_2_1_wav, BinaryData::high_tom_2_1_wavSize },
+		{ 50, 1, 1, "", "high_tom_2_2_wav", &BinaryData::high_tom_2_2_wav, BinaryData::high_tom_2_2_wavSize },
+		{ 50, 1, 2, "", "high_tom_2_3_wav", &BinaryData::high_tom_2_3_wav, BinaryData::high_tom_2_3_wavSize },
+		{ 50, 1, 3, "", "high_tom_2_4_wav", &BinaryData::high_tom_2_4_wav, BinaryData::high_tom_2_4_wavSize },
+		{ 50, 1, 4, "", "high_tom_2_5_wav", &BinaryData::high_tom_2_5_wav, BinaryData::high_tom_2_5_wavSize },
+		{ 50, 2, 0, "", "high_tom_3_1_wav", &BinaryData::high_tom_3_1_wav, BinaryData::high_tom_3_1_wavSize },
+		{ 50, 2, 1, "", "high_tom_3_2_wav", &BinaryData::high_tom_3_2_wav, BinaryData::high_tom_3_2_wavSize },
+		{ 50, 2, 2, "", "high_tom_3_3_wav", &BinaryData::high_tom_3_3_wav, BinaryData::high_tom_3_3_wavSize },
+		{ 50, 2, 3, "", "high_tom_3_4_wav", &BinaryData::high_tom_3_4_wav, BinaryData::high_tom_3_4_wavSize },
+		{ 50, 2, 4, "", "high_tom_3_5_wav", &BinaryData::high_tom_3_5_wav, BinaryData::high_tom_3_5_wavSize },
+		{ 51, 0, 0, "", "ride_cymbal_1_1_wav", &BinaryData::ride_cymbal_1_1_wav, BinaryData::ride_cymbal_1_1_wavSize },
+		{ 51, 0, 0, "left", "ride_cymbal_1_1_left_wav", &BinaryData::ride_cymbal_1_1_left_wav, BinaryData::ride_cymbal_1_1_left_wavSize },
+		{ 51, 0, 0, "right", "ride_cymbal_1_1_right_wav", &BinaryData::ride_cymbal_1_1_right_wav, BinaryData::ride_cymbal_1_1_right_wavSize },
+		{ 51, 0, 1, "", "ride_cymbal_1_2_wav", &BinaryData::ride_cymbal_1_2_wav, BinaryData::ride_cymbal_1_2_wavSize },
+		{ 51, 0, 1, "left", "ride_cymbal_1_2_left_wav", &BinaryData::ride_cymbal_1_2_left_wav, BinaryData::ride_cymbal_1_2_left_wavSize },
+		{ 51, 0, 1, "right", "ride_cymbal_1_2_right_wav", &BinaryData::ride_cymbal_1_2_right_wav, BinaryData::ride_cymbal_1_2_right_wavSize },
+		{ 51, 0, 2, "", "ride_cymbal_1_3_wav", &BinaryData::ride_cymbal_1_3_wav, BinaryData::ride_cymbal_1_3_wavSize },
+		{ 51, 0, 2, "left", "ride_cymbal_1_3_left_wav", &BinaryData::ride_cymbal_1_3_left_wav, BinaryData::ride_cymbal_1_3_left_wavSize },
+		{ 51, 0, 2, "right", "ride_cymbal_1_3_right_wav", &BinaryData::ride_cymbal_1_3_right_wav, BinaryData::ride_cymbal_1_3_right_wavSize },
+		{ 51, 0, 3, "", "ride_cymbal_1_4_wav", &BinaryData::ride_cymbal_1_4_wav, BinaryData::ride_cymbal_1_4_wavSize },
+		{ 51, 0, 3, "left", "ride_cymbal_1_4_left_wav", &BinaryData::ride_cymbal_1_4_left_wav, BinaryData::ride_cymbal_1_4_left_wavSize },
+		{ 51, 0, 3, "right", "ride_cymbal_1_4_right_wav", &BinaryData::ride_cymbal_1_4_right_wav, BinaryData::ride_cymbal_1_4_right_wavSize },
+		{ 51, 0, 4, "", "ride_cymbal_1_5_wav", &BinaryData::ride_cymbal_1_5_wav, BinaryData::ride_cymbal_1_5_wavSize },
+		{ 51, 0, 4, "left", "ride_cymbal_1_5_left_wav", &BinaryData::ride_cymbal_1_5_left_wav, BinaryData::ride_cymbal_1_5_left_wavSize },
+		{ 51, 0, 4, "right", "ride_cymbal_1_5_right_wav", &BinaryData::ride_cymbal_1_5_right_wav, BinaryData::ride_cymbal_1_5_right_wavSize },
+		{ 52, 0, 0, "", "chinese_cymbal_1_wav", &BinaryData::chinese_cymbal_1_wav, BinaryData::chinese_cymbal_1_wavSize },
+		{ 52, 0, 0, "left", "chinese_cymbal_1_left_wav", &BinaryData::chinese_cymbal_1_left_wav, BinaryData::chinese_cymbal_1_left_wavSize },
+		{ 52, 0, 0, "right", "chinese_cymbal_1_right_wav", &BinaryData::chinese_cymbal_1_right_wav, BinaryData::chinese_cymbal_1_right_wavSize },
+		{ 52, 0, 1, "", "chinese_cymbal_2_wav", &BinaryData::chinese_cymbal_2_wav, BinaryData::chinese_cymbal_2_wavSize },
+		{ 52, 0, 1, "left", "chinese_cymbal_2_left_wav", &BinaryData::chinese_cymbal_2_left_wav, BinaryData::chinese_cymbal_2_left_wavSize },
+		{ 52, 0, 1, "right", "chinese_cymbal_2_right_wav", &BinaryData::chinese_cymbal_2_right_wav, BinaryData::chinese_cymbal_2_right_wavSize },
+		{ 52, 0, 2, "", "chinese_cymbal_3_wav", &BinaryData::chinese_cymbal_3_wav, BinaryData::chinese_cymbal_3_wavSize },
+		{ 52, 0, 2, "left", "chinese_cymbal_3_left_wav", &BinaryData::chinese_cymbal_3_left_wav, BinaryData::chinese_cymbal_3_left_wavSize },
+		{ 52, 0, 2, "right", "chinese_cymbal_3_right_wav", &BinaryData::chinese_cymbal_3_right_wav, BinaryData::chinese_cymbal_3_right_wavSize },
+		{ 52, 0, 3, "", "chinese_cymbal_4_wav", &BinaryData::chinese_cymbal_4_wav, BinaryData::chinese_cymbal_4_wavSize },
+		{ 52, 0, 3, "left", "chinese_cymbal_4_left_wav", &BinaryData::chinese_cymbal_4_left_wav, BinaryData::chinese_cymbal_4_left_wavSize },
+		{ 52, 0, 3, "right", "chinese_cymbal_4_right_wav", &BinaryData::chinese_cymbal_4_right_wav, BinaryData::chinese_cymbal_4_right_wavSize },
+		{ 52, 0, 4, "", "chinese_cymbal_5_wav", &BinaryData::chinese_cymbal_5_wav, BinaryData::chinese_cymbal_5_wavSize },
+		{ 52, 0, 4, "left", "chinese_cymbal_5_left_wav", &BinaryData::chinese_cymbal_5_left_wav, BinaryData::chinese_cymbal_5_left_wavSize },
+		{ 52, 0, 4, "right", "chinese_cymbal_5_right_wav", &BinaryData::chinese_cymbal_5_right_wav, BinaryData::chinese_cymbal_5_right_wavSize },
+		{ 53, 0, 0, "", "ride_bell_1_1_wav", &BinaryData::ride_bell_1_1_wav, BinaryData::ride_bell_1_1_wavSize },
+		{ 53, 0, 0, "left", "ride_bell_1_1_left_wav", &BinaryData::ride_bell_1_1_left_wav, BinaryData::ride_bell_1_1_left_wavSize },
+		{ 53, 0, 0, "right", "ride_bell_1_1_right_wav", &BinaryData::ride_bell_1_1_right_wav, BinaryData::ride_bell_1_1_right_wavSize },
+		{ 53, 0, 1, "", "ride_bell_1_2_wav", &BinaryData::ride_bell_1_2_wav, BinaryData::ride_bell_1_2_wavSize },
+		{ 53, 0, 1, "left", "ride_bell_1_2_left_wav", &BinaryData::ride_bell_1_2_left_wav, BinaryData::ride_bell_1_2_left_wavSize },
+		{ 53, 0, 1, "right", "ride_bell_1_2_right_wav", &BinaryData::ride_bell_1_2_right_wav, BinaryData::ride_bell_1_2_right_wavSize },
+		{ 53, 0, 2, "", "ride_bell_1_3_wav", &BinaryData::ride_bell_1_3_wav, BinaryData::ride_bell_1_3_wavSize },
+		{ 53, 0, 2, "left", "ride_bell_1_3_left_wav", &BinaryData::ride_bell_1_3_left_wav, BinaryData::ride_bell_1_3_left_wavSize },
+		{ 53, 0, 2, "right", "ride_bell_1_3_right_wav", &BinaryData::ride_bell_1_3_right_wav, BinaryData::ride_bell_1_3_right_wavSize },
+		{ 53, 0, 3, "", "ride_bell_1_4_wav", &BinaryData::ride_bell_1_4_wav, BinaryData::ride_bell_1_4_wavSize },
+		{ 53, 0, 3, "left", "ride_bell_1_4_left_wav", &BinaryData::ride_bell_1_4_left_wav, BinaryData::ride_bell_1_4_left_wavSize },
+		{ 53, 0, 3, "right", "ride_bell_1_4_right_wav", &BinaryData::ride_bell_1_4_right_wav, BinaryData::ride_bell_1_4_right_wavSize },
+		{ 53, 0, 4, "", "ride_bell_1_5_wav", &BinaryData::ride_bell_1_5_wav, BinaryData::ride_bell_1_5_wavSize },
+		{ 53, 0, 4, "left", "ride_bell_1_5_left_wav", &BinaryData::ride_bell_1_5_left_wav, BinaryData::ride_bell_1_5_left_wavSize },
+		{ 53, 0, 4, "right", "ride_bell_1_5_right_wav", &BinaryData::ride_bell_1_5_right_wav, BinaryData::ride_bell_1_5_right_wavSize },
+		{ 53, 1, 0, "", "ride_bell_2_1_wav", &BinaryData::ride_bell_2_1_wav, BinaryData::ride_bell_2_1_wavSize },
+		{ 53, 1, 0, "left", "ride_bell_2_1_left_wav", &BinaryData::ride_bell_2_1_left_wav, BinaryData::ride_bell_2_1_left_wavSize },
+		{ 53, 1, 0, "right", "ride_bell_2_1_right_wav", &BinaryData::ride_bell_2_1_right_wav, BinaryData::ride_bell_2_1_right_wavSize },
+		{ 53, 1, 1, "", "ride_bell_2_2_wav", &BinaryData::ride_bell_2_2_wav, BinaryData::ride_bell_2_2_wavSize },
+		{ 53, 1, 1, "left", "ride_bell_2_2_left_wav", &BinaryData::ride_bell_2_2_left_wav, BinaryData::ride_bell_2_2_left_wavSize },
+		{ 53, 1, 1, "right", "ride_bell_2_2_right_wav", &BinaryData::ride_bell_2_2_right_wav, BinaryData::ride_bell_2_2_right_wavSize },
+		{ 53, 1, 2, "", "ride_bell_2_3_wav", &BinaryData::ride_bell_2_3_wav, BinaryData::ride_bell_2_3_wavSize },
+		{ 53, 1, 2, "left", "ride_bell_2_3_left_wav", &BinaryData::ride_bell_2_3_left_wav, BinaryData::ride_bell_2_3_left_wavSize },
+		{ 53, 1, 2, "right", "ride_bell_2_3_right_wav", &BinaryData::ride_bell_2_3_right_wav, BinaryData::ride_bell_2_3_right_wavSize },
+		{ 53, 1, 3, "", "ride_bell_2_4_wav", &BinaryData::ride_bell_2_4_wav, BinaryData::ride_bell_2_4_wavSize },
+		{ 53, 1, 3, "left", "ride_bell_2_4_left_wav", &BinaryData::ride_bell_2_4_left_wav, BinaryData::ride_bell_2_4_left_wavSize },
+		{ 53, 1, 3, "right", "ride_bell_2_4_right_wav", &BinaryData::ride_bell_2_4_right_wav, BinaryData::ride_bell_2_4_right_wavSize },
+		{ 53, 1, 4, "", "ride_bell_2_5_wav", &BinaryData::ride_bell_2_5_wav, BinaryData::ride_bell_2_5_wavSize },
+		{ 53, 1, 4, "left", "ride_bell_2_5_left_wav", &BinaryData::ride_bell_2_5_left_wav, BinaryData::ride_bell_2_5_left_wavSize },
+		{ 53, 1, 4, "right", "ride_bell_2_5_right_wav", &BinaryData::ride_bell_2_5_right_wav, BinaryData::ride_bell_2_5_right_wavSize },
+		{ 54, 0, 0, "", "tambourine_1_wav", &BinaryData::tambourine_1_wav, BinaryData::tambourine_1_wavSize },
+		{ 54, 0, 1, "", "tambourine_2_wav", &BinaryData::tambourine_2_wav, BinaryData::tambourine_2_wavSize },
+		{ 54, 0, 2, "", "tambourine_3_wav", &BinaryData::tambourine_3_wav, BinaryData::tambourine_3_wavSize },
+		{ 54, 0, 3, "", "tambourine_4_wav", &BinaryData::tambourine_4_wav, BinaryData::tambourine_4_wavSize },
+		{ 54, 0, 4, "", "tambourine_5_wav", &BinaryData::tambourine_5_wav, BinaryData::tambourine_5_wavSize },
+		{ 55, 0, 0, "", "splash_cymbal_1_wav", &BinaryData::splash_cymbal_1_wav, BinaryData::splash_cymbal_1_wavSize },
+		{ 55, 0, 0, "left", "splash_cymbal_1_left_wav", &BinaryData::splash_cymbal_1_left_wav, BinaryData::splash_cymbal_1_left_wavSize },
+		{ 55, 0, 0, "right", "splash_cymbal_1_right_wav", &BinaryData::splash_cymbal_1_right_wav, BinaryData::splash_cymbal_1_right_wavSize },
+		{ 55, 0, 1, "", "splash_cymbal_2_wav", &BinaryData::splash_cymbal_2_wav, BinaryData::splash_cymbal_2_wavSize },
+		{ 55, 0, 1, "left", "splash_cymbal_2_left_wav", &BinaryData::splash_cymbal_2_left_wav, BinaryData::splash_cymbal_2_left_wavSize },
+		{ 55, 0, 1, "right", "splash_cymbal_2_right_wav", &BinaryData::splash_cymbal_2_right_wav, BinaryData::splash_cymbal_2_right_wavSize },
+		{ 55, 0, 2, "", "splash_cymbal_3_wav", &BinaryData::splash_cymbal_3_wav, BinaryData::splash_cymbal_3_wavSize },
+		{ 55, 0, 2, "left", "splash_cymbal_3_left_wav", &BinaryData::splash_cymbal_3_left_wav, BinaryData::splash_cymbal_3_left_wavSize },
+		{ 55, 0, 2, "right", "splash_cymbal_3_right_wav", &BinaryData::splash_cymbal_3_right_wav, BinaryData::splash_cymbal_3_right_wavSize },
+		{ 55, 0, 3, "", "splash_cymbal_4_wav", &BinaryData::splash_cymbal_4_wav, BinaryData::splash_cymbal_4_wavSize },
+		{ 55, 0, 3, "left", "splash_cymbal_4_left_wav", &BinaryData::splash_cymbal_4_left_wav, BinaryData::splash_cymbal_4_left_wavSize },
+		{ 55, 0, 3, "right", "splash_cymbal_4_right_wav", &BinaryData::splash_cymbal_4_right_wav, BinaryData::splash_cymbal_4_right_wavSize },
+		{ 55, 0, 4, "", "splash_cymbal_5_wav", &BinaryData::splash_cymbal_5_wav, BinaryData::splash_cymbal_5_wavSize },
+		{ 55, 0, 4, "left", "splash_cymbal_5_left_wav", &BinaryData::splash_cymbal_5_left_wav, BinaryData::splash_cymbal_5_left_wavSize },
+		{ 55, 0, 4, "right", "splash_cymbal_5_right_wav", &BinaryData::splash_cymbal_5_right_wav, BinaryData::splash_cymbal_5_right_wavSize },
+		{ 56, 0, 0, "", "cowbell_1_wav", &BinaryData::cowbell_1_wav, BinaryData::cowbell_1_wavSize },
+		{ 56, 0, 1, "", "cowbell_2_wav", &BinaryData::cowbell_2_wav, BinaryData::cowbell_2_wavSize },
+		{ 56, 0, 2, "", "cowbell_3_wav", &BinaryData::cowbell_3_wav, BinaryData::cowbell_3_wavSize },
+		{ 56, 0, 3, "", "cowbell_4_wav", &BinaryData::cowbell_4_wav, BinaryData::cowbell_4_wavSize },
+		{ 56, 0, 4, "", "cowbell_5_wav", &BinaryData::cowbell_5_wav, BinaryData::cowbell_5_wavSize },
+		{ 57, 0, 0, "", "crash_cymbal_2_1_wav", &BinaryData::crash_cymbal_2_1_wav, BinaryData::crash_cymbal_2_1_wavSize },
+		{ 57, 0, 0, "left", "crash_cymbal_2_1_left_wav", &BinaryData::crash_cymbal_2_1_left_wav, BinaryData::crash_cymbal_2_1_left_wavSize },
+		{ 57, 0, 0, "right", "crash_cymbal_2_1_right_wav", &BinaryData::crash_cymbal_2_1_right_wav, BinaryData::crash_cymbal_2_1_right_wavSize },
+		{ 57, 0, 1, "", "crash_cymbal_2_2_wav", &BinaryData::crash_cymbal_2_2_wav, BinaryData::crash_cymbal_2_2_wavSize },
+		{ 57, 0, 1, "left", "crash_cymbal_2_2_left_wav", &BinaryData::crash_cymbal_2_2_left_wav, BinaryData::crash_cymbal_2_2_left_wavSize },
+		{ 57, 0, 1, "right", "crash_cymbal_2_2_right_wav", &BinaryData::crash_cymbal_2_2_right_wav, BinaryData::crash_cymbal_2_2_right_wavSize },
+		{ 57, 0, 2, "", "crash_cymbal_2_3_wav", &BinaryData::crash_cymbal_2_3_wav, BinaryData::crash_cymbal_2_3_wavSize },
+		{ 57, 0, 2, "left", "crash_cymbal_2_3_left_wav", &BinaryData::crash_cymbal_2_3_left_wav, BinaryData::crash_cymbal_2_3_left_wavSize },
+		{ 57, 0, 2, "right", "crash_cymbal_2_3_right_wav", &BinaryData::crash_cymbal_2_3_right_wav, BinaryData::crash_cymbal_2_3_right_wavSize },
+		{ 57, 0, 3, "", "crash_cymbal_2_4_wav", &BinaryData::crash_cymbal_2_4_wav, BinaryData::crash_cymbal_2_4_wavSize },
+		{ 57, 0, 3, "left", "crash_cymbal_2_4_left_wav", &BinaryData::crash_cymbal_2_4_left_wav, BinaryData::crash_cymbal_2_4_left_wavSize },
+		{ 57, 0, 3, "right", "crash_cymbal_2_4_right_wav", &BinaryData::crash_cymbal_2_4_right_wav, BinaryData::crash_cymbal_2_4_right_wavSize },
+		{ 57, 0, 4, "", "crash_cymbal_2_5_wav", &BinaryData::crash_cymbal_2_5_wav, BinaryData::crash_cymbal_2_5_wavSize },
+		{ 57, 0, 4, "left", "crash_cymbal_2_5_left_wav", &BinaryData::crash_cymbal_2_5_left_wav, BinaryData::crash_cymbal_2_5_left_wavSize },
+		{ 57, 0, 4, "right", "crash_cymbal_2_5_right_wav", &BinaryData::crash_cymbal_2_5_right_wav, BinaryData::crash_cymbal_2_5_right_wavSize },
+		{ 70, 0, 0, "", "maraca_1_wav", &BinaryData::maraca_1_wav, BinaryData::maraca_1_wavSize },
+		{ 70, 0, 1, "", "maraca_2_wav", &BinaryData::maraca_2_wav, BinaryData::maraca_2_wavSize },
+		{ 70, 0, 2, "", "maraca_3_wav", &BinaryData::maraca_3_wav, BinaryData::maraca_3_wavSize },
+		{ 70, 0, 3, "", "maraca_4_wav", &BinaryData::maraca_4_wav, BinaryData::maraca_4_wavSize },
+		{ 70, 0, 4, "", "maraca_5_wav", &BinaryData::maraca_5_wav, BinaryData::maraca_5_wavSize },
+		{ 80, 0, 0, "", "mute_triangle_1_wav", &BinaryData::mute_triangle_1_wav, BinaryData::mute_triangle_1_wavSize },
+		{ 80, 0, 1, "", "mute_triangle_2_wav", &BinaryData::mute_triangle_2_wav, BinaryData::mute_triangle_2_wavSize },
+		{ 80, 0, 2, "", "mute_triangle_3_wav", &BinaryData::mute_triangle_3_wav, BinaryData::mute_triangle_3_wavSize },
+		{ 80, 0, 3, "", "mute_triangle_4_wav", &BinaryData::mute_triangle_4_wav, BinaryData::mute_triangle_4_wavSize },
+		{ 80, 0, 4, "", "mute_triangle_5_wav", &BinaryData::mute_triangle_5_wav, BinaryData::mute_triangle_5_wavSize },
+		{ 81, 0, 0, "", "open_triangle_1_wav", &BinaryData::open_triangle_1_wav, BinaryData::open_triangle_1_wavSize },
+		{ 81, 0, 1, "", "open_triangle_2_wav", &BinaryData::open_triangle_2_wav, BinaryData::open_triangle_2_wavSize },
+		{ 81, 0, 2, "", "open_triangle_3_wav", &BinaryData::open_triangle_3_wav, BinaryData::open_triangle_3_wavSize },
+		{ 81, 0, 3, "", "open_triangle_4_wav", &BinaryData::open_triangle_4_wav, BinaryData::open_triangle_4_wavSize },
+		{ 81, 0, 4, "", "open_triangle_5_wav", &BinaryData::open_triangle_5_wav, BinaryData::open_triangle_5_wavSize },
+	};
+
+	static constexpr int size = (int)(sizeof(entries) / sizeof(entries[0]));
+}
@@ -2,11 +2,66 @@
 
 #include <vector>
 #include <map>
+#include <string>
 
 namespace Samples {
 	static constexpr int bitRate = 44100;
 	static constexpr int bitDepth = 24;
 
+	// Streaming keeps only the first streamingPreloadMilliseconds of each sample decoded in memory,
+	// 0 keeps every sample fully resident. Render hosts can override it through the environment.
+	// Every voice of every channel gets its own ring buffer, as long as the preload but at least
+	// streamingMinimumBufferLength frames.
+	static constexpr int streamingPreloadMillisecondsDefault = 0;
+	static constexpr int streamingMinimumBufferLength = 4096;
+	static const std::string streamingPreloadEnvironmentVariable = "PRO_PUNK_DRUMS_STREAMING_PRELOAD_MS";
+
+	// A kit file (see PluginKitFile.h) replaces the embedded samples when this points at one.
+	static const std::string kitFileEnvironmentVariable = "PRO_PUNK_DRUMS_KIT_FILE";
+
+	// A stereo room impulse response, taken from roomImpulseResponseFileName next to the kit file
+	// or from the environment, replaces the algorithmic room reverb. It is convolved with no
+	// added latency: the first roomConvolutionHeadBlocks host blocks of it on the audio thread,
+	// in partitions starting at roomConvolutionHeadSize frames, and the rest on a background
+	// thread (see PluginRoomConvolution).
+	static const std::string roomImpulseResponseFileName = "room.wav";
+	static const std::string roomImpulseResponseEnvironmentVariable = "PRO_PUNK_DRUMS_ROOM_IMPULSE_RESPONSE";
+	static constexpr int roomConvolutionHeadSize = 256;
+	static constexpr int roomConvolutionHeadBlocks = 2; // the background thread gets a block of slack
+
+	// Load-time trimming. Leading frames before a hit first exceeds leadingSilenceDecibels are
+	// dropped, by the same amount from every mic of the hit so they stay aligned. Tails are cut
+	// once they stay below tailFloorDecibels, ending in a tailFadeMilliseconds fade. Both are off
+	// by default so samples play as recorded; set a negative threshold through the environment
+	// to enable either, 0 disables it.
+	static constexpr float leadingSilenceDecibelsDefault = 0.0f;
+	static constexpr float tailFloorDecibelsDefault = 0.0f;
+	static constexpr int tailFadeMilliseconds = 10;
+	static const std::string leadingSilenceEnvironmentVariable = "PRO_PUNK_DRUMS_LEADING_SILENCE_DB";
+	static const std::string tailFloorEnvironmentVariable = "PRO_PUNK_DRUMS_TAIL_FLOOR_DB";
+
+	// In-memory sample format, one of the PluginSampleStorage ids. Packed and lossless formats
+	// are decoded by the voices as they play.
+	static const std::string sampleFormatDefault = "float32";
+	static const std::string sampleFormatEnvironmentVariable = "PRO_PUNK_DRUMS_SAMPLE_FORMAT";
+
+	// Each synthesiser preallocates polyphony voices plus stealFadeVoices spare ones, whatever
+	// the number of samples. Past polyphony the oldest hit fades out over stealFadeMilliseconds
+	// on its own voice while a spare one plays the new hit.
+	static constexpr int polyphonyDefault = 64;
+	static constexpr int stealFadeVoices = 8;
+	static constexpr float stealFadeMilliseconds = 5.0f;
+	static const std::string polyphonyEnvironmentVariable = "PRO_PUNK_DRUMS_POLYPHONY";
+
+	// A voice ends early once the peak left in its sample, times its velocity, mic gain and pan,
+	// stays below voiceFloorDecibels. Overridable through the environment, 0 plays every sample out.
+	static constexpr float voiceFloorDecibelsDefault = -96.0f;
+	static const std::string voiceFloorEnvironmentVariable = "PRO_PUNK_DRUMS_VOICE_FLOOR_DB";
+
+	// Reserved up front for each channel's share of a block's MIDI, so routing does not allocate
+	// on the audio thread for any realistic block.
+	static constexpr int midiBufferBytesPerChannel = 4096;
+
 	static const std::string leftComponentId = "left";
 	static const std::string rightComponentId = "right";
 	static const std::string bottomComponentId = "bottom";
@@ -26,4 +26,6 @@ namespace Strings {
 	static const std::string reverb = "Reverb";
 	static const std::string room = "Room";
 	static const std::string roomSend = "Room";
+	static const std::string postFader = "Post fader";
+	static const std::string loadingSamples = "Loading samples";
 }
@@ -1,6 +1,7 @@
 #include "PluginAudioProcessor.h"
 #include "PluginAudioProcessorEditor.h"
 #include "Configuration/Samples.h"
+#include "Configuration/SampleManifest.h"
 #include "Synthesiser/PluginSynthesiser.h"
 #include "PluginUtils.h"
 #include "Configuration/Midi.h"
@@ -30,7 +31,10 @@ PluginAudioProcessor::PluginAudioProcessor()
 	),
 	mAudioProcessorValueTreeStatePtr(std::make_unique<juce::AudioProcessorValueTreeState>(*this, nullptr, juce::Identifier("plugin_params"), createParameterLayout())),
 	mAudioFormatManagerPtr(std::make_unique<juce::AudioFormatManager>()),
-	mRoomBufferPtr(std::make_unique<juce::AudioBuffer<float>>(2, 1024))
+	mSampleLoaderThreadPoolPtr(std::make_unique<juce::ThreadPool>(juce::jmax(1, juce::SystemStats::getNumCpus() - 1))),
+	mRoomBufferPtr(std::make_unique<juce::AudioBuffer<float>>(2, 1024)),
+	mRoomReverbPtr(std::make_unique<juce::dsp::Reverb>()),
+	mRoomFdnReverbPtr(std::make_unique<PluginFdnReverb>())
 #endif
 {
 	mAudioFormatManagerPtr->registerBasicFormats();
@@ -38,139 +42,127 @@ PluginAudioProcessor::PluginAudioProcessor()
 	mAudioProcessorValueTreeStatePtr->state.setProperty("version", ProjectInfo::versionString, nullptr);
 	mPresetManagerPtr = std::make_unique<PluginPresetManager>(*mAudioProcessorValueTreeStatePtr.get());
 
-	for (int channelIndex = 0; channelIndex < Channels::size; channelIndex++) {
-		if (channelIndex != Channels::outputChannelIndex || channelIndex != Channels::roomChannelIndex)
+	{
+		PluginLoadTimings::ScopedPhase phase(mLoadTimings, "synthesisers");
+
+		const int polyphony = juce::SystemStats::getEnvironmentVariable(
+			Samples::polyphonyEnvironmentVariable,
+			juce::String(Samples::polyphonyDefault)).getIntValue();
+
+		const int streamingPreloadMilliseconds = juce::SystemStats::getEnvironmentVariable(
+			Samples::streamingPreloadEnvironmentVariable,
+			juce::String(Samples::streamingPreloadMillisecondsDefault)).getIntValue();
+
+		if (streamingPreloadMilliseconds > 0)
+		{
+			// A ring for every voice of every synthesiser, so no voice is ever left without one.
+			const int numberOfVoices = Channels::size * (juce::jmax(1, polyphony) + Samples::stealFadeVoices);
+			mSampleStreamerPtr = std::make_unique<PluginSampleStreamer>(streamingPreloadMilliseconds, numberOfVoices);
+		}
+
+		const auto sampleStorageFormat = PluginSampleStorage::formatFromId(juce::SystemStats::getEnvironmentVariable(
+			Samples::sampleFormatEnvironmentVariable,
+			Samples::sampleFormatDefault).toStdString());
+
+		const float voiceFloorDecibels = juce::SystemStats::getEnvironmentVariable(
+			Samples::voiceFloorEnvironmentVariable,
+			juce::String(Samples::voiceFloorDecibelsDefault)).getFloatValue();
+		const float voiceFloorGain = voiceFloorDecibels < 0.0f ? juce::Decibels::decibelsToGain(voiceFloorDecibels) : 0.0f;
+
+		for (int channelIndex = 0; channelIndex < Channels::size; channelIndex++) {
+			if (channelIndex != Channels::outputChannelIndex || channelIndex != Channels::roomChannelIndex)
+			{
+				mSynthesiserPtrVector.push_back(std::make_unique<PluginSynthesiser>(mSampleStreamerPtr.get(), sampleStorageFormat, polyphony, voiceFloorGain));
+				mSynthesiserBufferPtrVector.push_back(std::make_unique<juce::AudioBuffer<float>>(2, 1024));
+				mSynthesiserMidiBuffers.emplace_back();
+				mReverbGains.push_back(std::make_unique<juce::dsp::Gain<float>>());
+				mReverbPostFaderParameters.push_back(dynamic_cast<juce::AudioParameterBool*>(mAudioProcessorValueTreeStatePtr->getParameter(
+					stringsJoinAndSnakeCase({ Channels::channelIndexToIdMap.at(channelIndex), AudioParameters::reverbComponentId, AudioParameters::postFaderComponentId }))));
+				mReverbBufferPtrVector.push_back(std::make_unique<juce::AudioBuffer<float>>(2, 1024));
+			}
+
+			mCompressors.push_back(std::make_unique<juce::dsp::Compressor<float>>());
+			mCompressorGains.push_back(std::make_unique<juce::dsp::Gain<float>>());
+			mCompressorDryWetMixers.push_back(std::make_unique<juce::dsp::DryWetMixer<float>>());
+			mChannelGains.push_back(std::make_unique<juce::dsp::Gain<float>>());
+		}
+
+		mEqualizerBank.prepare(Channels::size, 2); // coefficients may be set before prepareToPlay
+
+		const int numberOfChannelWorkers = juce::SystemStats::getEnvironmentVariable(
+			Channels::workersEnvironmentVariable,
+			juce::String(Channels::workersDefault)).getIntValue();
+
+		if (numberOfChannelWorkers > 0)
 		{
-			mSynthesiserPtrVector.push_back(std::make_unique<PluginSynthesiser>());
-			mSynthesiserBufferPtrVector.push_back(std::make_unique<juce::AudioBuffer<float>>(2, 1024));
-			mReverbGains.push_back(std::make_unique<juce::dsp::Gain<float>>());
-			mReverbs.push_back(std::make_unique<juce::dsp::Reverb>());
-			mReverbBufferPtrVector.push_back(std::make_unique<juce::AudioBuffer<float>>(2, 1024));
+			mChannelWorkersPtr = std::make_unique<PluginChannelWorkers>(numberOfChannelWorkers, Channels::roomChannelIndex, [this](const int channelIndex)
+				{
+					processChannel(channelIndex);
+				});
 		}
 
-		mCompressors.push_back(std::make_unique<juce::dsp::Compressor<float>>());
-		mCompressorGains.push_back(std::make_unique<juce::dsp::Gain<float>>());
-		mCompressorDryWetMixers.push_back(std::make_unique<juce::dsp::DryWetMixer<float>>());
-		mChannelGains.push_back(std::make_unique<juce::dsp::Gain<float>>());
-		mLowShelfFilters.emplace_back();
-		mPeakFilters.emplace_back();
-		mHighShelfFilters.emplace_back();
+		mMidiNoteToChannelIndex.fill(-1);
+
+		for (const auto& midiNoteAndChannelIndex : Channels::generalMidiNoteToChannelIndex)
+		{
+			mMidiNoteToChannelIndex[(size_t)midiNoteAndChannelIndex.first] = midiNoteAndChannelIndex.second;
+		}
 	}
 
-	for (int resourceIndex = 0; resourceIndex < BinaryData::namedResourceListSize; resourceIndex++)
 	{
-		std::string namedResource = BinaryData::namedResourceList[resourceIndex];
-		std::string micId, midiName, generalMidiSnakeCaseName = "";
-		int variationIndex, velocityIndex, midiNote = -1;
+		PluginLoadTimings::ScopedPhase phase(mLoadTimings, "sample resources");
+
+		const auto leadingSilenceDecibels = juce::SystemStats::getEnvironmentVariable(
+			Samples::leadingSilenceEnvironmentVariable,
+			juce::String(Samples::leadingSilenceDecibelsDefault)).getFloatValue();
+		const auto tailFloorDecibels = juce::SystemStats::getEnvironmentVariable(
+			Samples::tailFloorEnvironmentVariable,
+			juce::String(Samples::tailFloorDecibelsDefault)).getFloatValue();
+
+		mLeadingSilenceGain = leadingSilenceDecibels < 0.0f ? juce::Decibels::decibelsToGain(leadingSilenceDecibels) : 0.0f;
+		mTailFloorGain = tailFloorDecibels < 0.0f ? juce::Decibels::decibelsToGain(tailFloorDecibels) : 0.0f;
 
-		for (int midiNameIndex = 0; midiNameIndex < GeneralMidiPercussion::midiNamesVector.size(); midiNameIndex++)
+		const auto kitFile = juce::File::createFileWithoutCheckingPath(juce::SystemStats::getEnvironmentVariable(Samples::kitFileEnvironmentVariable, ""));
+
+		if (kitFile.existsAsFile())
 		{
-			midiNote = -1;
-			midiName = GeneralMidiPercussion::midiNamesVector.at(midiNameIndex);
-			generalMidiSnakeCaseName = stringToSnakeCase(midiName);
+			mKitFilePtr = std::make_unique<PluginKitFile>(kitFile);
+		}
 
-			std::string cleanedNamedResource = namedResource.substr(0, namedResource.size() - 4);
-			size_t pos = cleanedNamedResource.find(generalMidiSnakeCaseName);
-			if (pos == 0)
-			{
-				std::string resourceMetadata = cleanedNamedResource.substr(pos + generalMidiSnakeCaseName.length());
+		auto roomImpulseResponseFile = juce::File::createFileWithoutCheckingPath(juce::SystemStats::getEnvironmentVariable(Samples::roomImpulseResponseEnvironmentVariable, ""));
 
-				std::istringstream iss(resourceMetadata);
-				std::vector<std::string> parts;
-				std::string part;
+		if (!roomImpulseResponseFile.existsAsFile() && kitFile.existsAsFile())
+		{
+			roomImpulseResponseFile = kitFile.getSiblingFile(Samples::roomImpulseResponseFileName);
+		}
 
-				while (std::getline(iss, part, '_'))
-				{
-					if (!part.empty()) {
-						parts.push_back(part);
-					}
-				}
+		if (roomImpulseResponseFile.existsAsFile())
+		{
+			// Read here, split and partitioned for the host rate in prepareToPlay.
+			std::unique_ptr<juce::AudioFormatReader> reader(mAudioFormatManagerPtr->createReaderFor(roomImpulseResponseFile));
 
-				switch (parts.size())
-				{
-				case 0:
-					midiNote = GeneralMidiPercussion::midiNameToNoteMap.at(midiName);
-					velocityIndex = 0;
-					variationIndex = 0;
-					break;
-				case 1:
-					midiNote = GeneralMidiPercussion::midiNameToNoteMap.at(midiName);
-					velocityIndex = 0;
-					if (stringIsNumeric(parts[0]))
-					{
-						variationIndex = std::stoi(parts[0].substr(0, parts[0].find("_"))) - 1;
-					}
-					else
-					{
-						variationIndex = 0;
-						micId = parts[0];
-					}
-					break;
-				case 2:
-					if (stringIsNumeric(parts[0]) && stringIsNumeric(parts[1]))
-					{
-						midiNote = GeneralMidiPercussion::midiNameToNoteMap.at(midiName);
-						velocityIndex = std::stoi(parts[0]) - 1;
-						variationIndex = std::stoi(parts[1]) - 1;
-					}
-					else
-					{
-						midiNote = GeneralMidiPercussion::midiNameToNoteMap.at(midiName);
-						velocityIndex = 0;
-						variationIndex = std::stoi(parts[0]) - 1;
-						micId = parts[1];
-					}
-					break;
-				case 3:
-					if (stringIsNumeric(parts[0]) && stringIsNumeric(parts[1]))
-					{
-						midiNote = GeneralMidiPercussion::midiNameToNoteMap.at(midiName);
-						velocityIndex = std::stoi(parts[0]) - 1;
-						variationIndex = std::stoi(parts[1]) - 1;
-						micId = parts[2];
-					}
-					else
-					{
-						DBG("invalid name " + generalMidiSnakeCaseName);
-						midiNameIndex = (int)GeneralMidiPercussion::midiNamesVector.size() + 1;
-					}
-					break;
-				default:
-					DBG("invalid name " + generalMidiSnakeCaseName);
-					midiNameIndex = (int)GeneralMidiPercussion::midiNamesVector.size() + 1;
-					break;
-				}
+			if (reader != nullptr)
+			{
+				mRoomConvolutionPtr = std::make_unique<PluginRoomConvolution>(*reader);
 			}
-
-			if (midiNote != -1)
+			else
 			{
-				auto* gainParameter = mAudioProcessorValueTreeStatePtr->getParameter(stringsJoinAndSnakeCase({ std::to_string(midiNote), micId, AudioParameters::gainComponentId }));
-				auto* panParameter = mAudioProcessorValueTreeStatePtr->getParameter(stringsJoinAndSnakeCase({ std::to_string(midiNote), micId, AudioParameters::panComponentId }));
-				auto* phaseParameter = dynamic_cast<juce::AudioParameterBool*>(mAudioProcessorValueTreeStatePtr->getParameter(stringsJoinAndSnakeCase({ std::to_string(midiNote), micId, AudioParameters::phaseComponentId })));
-
-				auto& synthesiser = mSynthesiserPtrVector.at(Channels::generalMidiNoteToChannelIndex.at(midiNote));
-
-				synthesiser->addSample(
-					namedResource,
-					Samples::bitRate,
-					Samples::bitDepth,
-					midiNote,
-					micId,
-					GeneralMidiPercussion::midiNoteToStopNotesMap.at(midiNote),
-					velocityIndex,
-					variationIndex,
-					*mAudioFormatManagerPtr.get(),
-					*gainParameter,
-					*panParameter,
-					*phaseParameter
-				);
+				DBG("unreadable room impulse response " + roomImpulseResponseFile.getFullPathName());
 			}
 		}
+
+		auto midiNoteToSampleResources = mKitFilePtr != nullptr && mKitFilePtr->isValid()
+			? getKitFileSampleResources()
+			: getBinaryDataSampleResources();
+
+		loadSampleResources(midiNoteToSampleResources);
 	}
 
 	mAudioProcessorValueTreeStatePtr->addParameterListener(AudioParameters::roomSizeComponentId, this);
 	mAudioProcessorValueTreeStatePtr->addParameterListener(AudioParameters::dampingComponentId, this);
 	mAudioProcessorValueTreeStatePtr->addParameterListener(AudioParameters::widthComponentId, this);
+
+	mDenseRoomParameter = dynamic_cast<juce::AudioParameterBool*>(mAudioProcessorValueTreeStatePtr->getParameter(AudioParameters::denseRoomComponentId));
 	
 	for (const auto& channel : Channels::channelIndexToIdMap) {
 		const auto& channelId = channel.second;
@@ -214,7 +206,75 @@ PluginAudioProcessor::PluginAudioProcessor()
 	}
 }
 
+std::map<int, std::vector<PluginAudioProcessor::SampleResource>> PluginAudioProcessor::getBinaryDataSampleResources()
+{
+	std::map<int, std::vector<SampleResource>> midiNoteToSampleResources;
+
+	for (const auto& manifestEntry : SampleManifest::entries)
+	{
+		SampleResource sampleResource;
+		sampleResource.resourceName = manifestEntry.resourceName;
+		sampleResource.resourceData = *manifestEntry.data;
+		sampleResource.resourceDataSize = manifestEntry.dataSize;
+		sampleResource.midiNote = manifestEntry.midiNote;
+		sampleResource.micId = manifestEntry.micId;
+		sampleResource.velocityIndex = manifestEntry.velocityIndex;
+		sampleResource.variationIndex = manifestEntry.variationIndex;
+
+		midiNoteToSampleResources[manifestEntry.midiNote].push_back(sampleResource);
+	}
+
+	return midiNoteToSampleResources;
+}
+
+std::map<int, std::vector<PluginAudioProcessor::SampleResource>> PluginAudioProcessor::getKitFileSampleResources()
+{
+	std::map<int, std::vector<SampleResource>> midiNoteToSampleResources;
+	const auto& kitFileEntries = mKitFilePtr->getEntries();
+
+	for (int kitFileEntryIndex = 0; kitFileEntryIndex < kitFileEntries.size(); kitFileEntryIndex++)
+	{
+		const auto& kitFileEntry = kitFileEntries[kitFileEntryIndex];
+
+		if (Channels::generalMidiNoteToChannelIndex.find(kitFileEntry.midiNote) == Channels::generalMidiNoteToChannelIndex.end())
+		{
+			DBG("kit file note out of range " + std::to_string(kitFileEntry.midiNote));
+			continue;
+		}
+
+		SampleResource sampleResource;
+		sampleResource.midiNote = kitFileEntry.midiNote;
+		sampleResource.micId = kitFileEntry.micId;
+		sampleResource.velocityIndex = kitFileEntry.velocityIndex;
+		sampleResource.variationIndex = kitFileEntry.variationIndex;
+		sampleResource.kitFileEntryIndex = kitFileEntryIndex;
+
+		midiNoteToSampleResources[kitFileEntry.midiNote].push_back(sampleResource);
+	}
+
+	return midiNoteToSampleResources;
+}
+
+bool PluginAudioProcessor::exportKitFile(const juce::File& file)
+{
+	if (isLoadingSamples())
+	{
+		return false;
+	}
+
+	std::vector<std::pair<PluginKitFile::Entry, const juce::AudioBuffer<float>*>> samples;
+
+	for (const auto& synthesiser : mSynthesiserPtrVector)
+	{
+		const auto synthesiserSamples = synthesiser->getKitFileSamples();
+		samples.insert(samples.end(), synthesiserSamples.begin(), synthesiserSamples.end());
+	}
+
+	return PluginKitFile::write(file, samples);
+}
+
 juce::AudioProcessorValueTreeState::ParameterLayout PluginAudioProcessor::createParameterLayout() {
+	PluginLoadTimings::ScopedPhase phase(mLoadTimings, "parameter layout");
 	juce::AudioProcessorValueTreeState::ParameterLayout layout;
 
 	layout.add(std::make_unique<juce::AudioParameterBool>(
@@ -240,6 +300,11 @@ juce::AudioProcessorValueTreeState::ParameterLayout PluginAudioProcessor::create
 		AudioParameters::widthNormalisableRange,
 		AudioParameters::widthDefaultValue));
 
+	layout.add(std::make_unique<juce::AudioParameterBool>(
+		juce::ParameterID{ AudioParameters::denseRoomComponentId, 1 },
+		stringToTitleCase(AudioParameters::denseRoomComponentId),
+		false));
+
 	for (const auto& pair : AudioParameters::getUniqueMidiNoteMicCombinations()) {
 		int midiNote = pair.first;
 		const std::set<std::string>& micIds = pair.second;
@@ -332,6 +397,15 @@ juce::AudioProcessorValueTreeState::ParameterLayout PluginAudioProcessor::create
 			AudioParameters::gainNormalisableRange,
 			AudioParameters::reverbGainDefaultValue));
 
+		const auto reverbPostFaderId = stringsJoinAndSnakeCase({
+			channelId,
+			AudioParameters::reverbComponentId,
+			AudioParameters::postFaderComponentId });
+		layout.add(std::make_unique<juce::AudioParameterBool>(
+			juce::ParameterID{ reverbPostFaderId, 1 },
+			stringToTitleCase(reverbPostFaderId),
+			false));
+
 		for (const auto& equalizationTypeId : AudioParameters::equalizationTypeIdVector) {
 			const auto equalizationFrequencyDefaultValue = AudioParameters::equalizationTypeIdToDefaultFrequencyMap.at(equalizationTypeId);
 
@@ -370,6 +444,230 @@ juce::AudioProcessorValueTreeState::ParameterLayout PluginAudioProcessor::create
 
 PluginAudioProcessor::~PluginAudioProcessor()
 {
+	mIsSampleLoadingCancelled.store(true);
+	mSampleLoaderThreadPoolPtr->removeAllJobs(true, -1);
+
+	if (mSampleStreamerPtr != nullptr)
+	{
+		mSampleStreamerPtr->stop();
+	}
+}
+
+void PluginAudioProcessor::loadSampleResources(std::map<int, std::vector<SampleResource>> midiNoteToSampleResources)
+{
+	for (auto& midiNoteAndSampleResources : midiNoteToSampleResources)
+	{
+		const int midiNote = midiNoteAndSampleResources.first;
+		auto& synthesiser = mSynthesiserPtrVector.at(Channels::generalMidiNoteToChannelIndex.at(midiNote));
+
+		synthesiser->addInstrument(midiNote, GeneralMidiPercussion::midiNoteToStopNotesMap.at(midiNote));
+
+		for (auto& sampleResource : midiNoteAndSampleResources.second)
+		{
+			sampleResource.gainParameter = mAudioProcessorValueTreeStatePtr->getParameter(stringsJoinAndSnakeCase({ std::to_string(midiNote), sampleResource.micId, AudioParameters::gainComponentId }));
+			sampleResource.panParameter = mAudioProcessorValueTreeStatePtr->getParameter(stringsJoinAndSnakeCase({ std::to_string(midiNote), sampleResource.micId, AudioParameters::panComponentId }));
+			sampleResource.phaseParameter = dynamic_cast<juce::AudioParameterBool*>(mAudioProcessorValueTreeStatePtr->getParameter(stringsJoinAndSnakeCase({ std::to_string(midiNote), sampleResource.micId, AudioParameters::phaseComponentId })));
+		}
+
+		// Kit files may carry mics the parameter layout doesn't know about.
+		auto& sampleResources = midiNoteAndSampleResources.second;
+		sampleResources.erase(std::remove_if(sampleResources.begin(), sampleResources.end(), [](const SampleResource& sampleResource)
+			{
+				return sampleResource.gainParameter == nullptr || sampleResource.panParameter == nullptr || sampleResource.phaseParameter == nullptr;
+			}), sampleResources.end());
+
+		mNumberOfSamplesToLoad += (int)sampleResources.size();
+	}
+
+	// One job per instrument: a job only ever touches its own instrument, which is
+	// published to the audio thread once all of its samples are decoded.
+	mNumberOfInstrumentsToLoad = (int)midiNoteToSampleResources.size();
+	mSampleLoadingStartMilliseconds = PluginLoadTimings::getMillisecondCounter();
+
+	for (const auto& midiNoteAndSampleResources : midiNoteToSampleResources)
+	{
+		const int midiNote = midiNoteAndSampleResources.first;
+		const auto sampleResources = midiNoteAndSampleResources.second;
+		auto* synthesiser = mSynthesiserPtrVector.at(Channels::generalMidiNoteToChannelIndex.at(midiNote)).get();
+
+		mSampleLoaderThreadPoolPtr->addJob([this, synthesiser, midiNote, sampleResources]()
+			{
+				// Every mic of a hit starts where the earliest of them crosses the threshold.
+				std::map<std::pair<int, int>, juce::int64> hitToStartFrame;
+
+				for (const auto& sampleResource : sampleResources)
+				{
+					if (sampleResource.kitFileEntryIndex >= 0 || mSampleStreamerPtr != nullptr || mLeadingSilenceGain <= 0.0f)
+					{
+						continue;
+					}
+
+					const auto hit = std::make_pair(sampleResource.velocityIndex, sampleResource.variationIndex);
+					const auto startFrame = mSamplePool->getOrFindStart(sampleResource.resourceName, mLeadingSilenceGain, [this, &sampleResource]()
+						{
+							return PluginSynthesiser::findSampleStart(sampleResource.resourceData, sampleResource.resourceDataSize, *mAudioFormatManagerPtr, mLeadingSilenceGain);
+						});
+					auto hitAndStartFrame = hitToStartFrame.find(hit);
+
+					if (hitAndStartFrame == hitToStartFrame.end())
+					{
+						hitToStartFrame[hit] = startFrame;
+					}
+					else
+					{
+						hitAndStartFrame->second = juce::jmin(hitAndStartFrame->second, startFrame);
+					}
+				}
+
+				for (const auto& sampleResource : sampleResources)
+				{
+					if (mIsSampleLoadingCancelled.load())
+					{
+						return;
+					}
+
+					if (sampleResource.kitFileEntryIndex >= 0)
+					{
+						synthesiser->addKitSample(
+							*mKitFilePtr,
+							mKitFilePtr->getEntries()[sampleResource.kitFileEntryIndex],
+							*sampleResource.gainParameter,
+							*sampleResource.panParameter,
+							*sampleResource.phaseParameter
+						);
+
+						mNumberOfSamplesLoaded++;
+						continue;
+					}
+
+					synthesiser->addSample(
+						sampleResource.resourceName,
+						sampleResource.resourceData,
+						sampleResource.resourceDataSize,
+						Samples::bitRate,
+						Samples::bitDepth,
+						midiNote,
+						sampleResource.micId,
+						sampleResource.velocityIndex,
+						sampleResource.variationIndex,
+						*mAudioFormatManagerPtr.get(),
+						*mSamplePool,
+						hitToStartFrame[std::make_pair(sampleResource.velocityIndex, sampleResource.variationIndex)],
+						mTailFloorGain,
+						*sampleResource.gainParameter,
+						*sampleResource.panParameter,
+						*sampleResource.phaseParameter
+					);
+
+					mNumberOfSamplesLoaded++;
+				}
+
+				synthesiser->setInstrumentLoaded(midiNote);
+
+				if (--mNumberOfInstrumentsToLoad == 0)
+				{
+					mLoadTimings.record("sample decoding", PluginLoadTimings::getMillisecondCounter() - mSampleLoadingStartMilliseconds);
+				}
+
+				const double resampleSampleRate = mResampleSampleRate.load();
+
+				if (resampleSampleRate > 0.0)
+				{
+					synthesiser->resampleInstrument(midiNote, resampleSampleRate);
+				}
+			});
+	}
+}
+
+void PluginAudioProcessor::resampleSamples(const double sampleRate)
+{
+	mResampleSampleRate.store(sampleRate);
+
+	// Instruments still loading are resampled by their loader job instead.
+	mSampleLoaderThreadPoolPtr->addJob([this, sampleRate]
+		{
+			for (auto& synthesiser : mSynthesiserPtrVector)
+			{
+				for (const int midiNote : synthesiser->getMidiNotesVector())
+				{
+					if (mIsSampleLoadingCancelled.load() || mResampleSampleRate.load() != sampleRate)
+					{
+						return;
+					}
+
+					synthesiser->resampleInstrument(midiNote, sampleRate);
+				}
+			}
+		});
+}
+
+float PluginAudioProcessor::getSampleLoadingProgress() const
+{
+	if (mNumberOfSamplesToLoad == 0)
+	{
+		return 1.0f;
+	}
+
+	return (float)mNumberOfSamplesLoaded.load() / (float)mNumberOfSamplesToLoad;
+}
+
+bool PluginAudioProcessor::isLoadingSamples() const
+{
+	return mNumberOfSamplesLoaded.load() < mNumberOfSamplesToLoad;
+}
+
+int PluginAudioProcessor::getStreamingUnderrunCount() const
+{
+	return mSampleStreamerPtr != nullptr ? mSampleStreamerPtr->getUnderrunCount() : 0;
+}
+
+float PluginAudioProcessor::getSampleCompressionRatio()
+{
+	size_t memorySize = 0;
+	size_t uncompressedMemorySize = 0;
+
+	for (auto& synthesiser : mSynthesiserPtrVector)
+	{
+		memorySize += synthesiser->getSampleMemorySize();
+		uncompressedMemorySize += synthesiser->getUncompressedSampleMemorySize();
+	}
+
+	return memorySize > 0 ? (float)uncompressedMemorySize / (float)memorySize : 1.0f;
+}
+
+size_t PluginAudioProcessor::getSharedSampleMemorySize()
+{
+	return mSamplePool->getMemorySize();
+}
+
+std::map<int, PluginSynthesiser::TrimReport> PluginAudioProcessor::getSampleTrimReports()
+{
+	std::map<int, PluginSynthesiser::TrimReport> trimReports;
+
+	for (auto& synthesiser : mSynthesiserPtrVector)
+	{
+		const auto synthesiserTrimReports = synthesiser->getTrimReports();
+		trimReports.insert(synthesiserTrimReports.begin(), synthesiserTrimReports.end());
+	}
+
+	return trimReports;
+}
+
+PluginLoadTimings& PluginAudioProcessor::getLoadTimings()
+{
+	return mLoadTimings;
+}
+
+size_t PluginAudioProcessor::getSampleMemorySize()
+{
+	size_t memorySize = 0;
+
+	for (auto& synthesiser : mSynthesiserPtrVector)
+	{
+		memorySize += synthesiser->getSampleMemorySize();
+	}
+
+	return memorySize;
 }
 
 std::vector<int> PluginAudioProcessor::getMidiNotesVector()
@@ -461,6 +759,7 @@ void PluginAudioProcessor::changeProgramName(int index, const juce::String& newN
 void PluginAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
 	DBG("prepareToPlay");
+	PluginLoadTimings::ScopedPhase phase(mLoadTimings, "prepare to play");
 
 	juce::dsp::ProcessSpec spec;
 	spec.sampleRate = sampleRate;
@@ -469,6 +768,29 @@ void PluginAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 
 	mRoomBufferPtr->setSize(2, samplesPerBlock);
 
+	resampleSamples(sampleRate);
+
+	mRoomReverbPtr->prepare(spec);
+	mRoomReverbPtr->setParameters({
+		mAudioProcessorValueTreeStatePtr->getParameterAsValue(AudioParameters::roomSizeComponentId).getValue(),
+		mAudioProcessorValueTreeStatePtr->getParameterAsValue(AudioParameters::dampingComponentId).getValue(),
+		1.0f,
+		0.0f,
+		mAudioProcessorValueTreeStatePtr->getParameterAsValue(AudioParameters::widthComponentId).getValue(),
+		0.0f });
+
+	mRoomFdnReverbPtr->prepare(spec);
+	mRoomFdnReverbPtr->setParameters(mRoomReverbPtr->getParameters());
+
+	if (mRoomConvolutionPtr != nullptr)
+	{
+		auto roomSpec = spec;
+		roomSpec.numChannels = 2;
+		mRoomConvolutionPtr->prepare(roomSpec);
+	}
+
+	mEqualizerBank.prepare(Channels::size, (int)spec.numChannels);
+
 	for (const auto& channel : Channels::channelIndexToIdMap) {
 		const auto channelIndex = channel.first;
 		const auto& channelId = channel.second;
@@ -478,21 +800,13 @@ void PluginAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 			mSynthesiserPtrVector[channelIndex]->setCurrentPlaybackSampleRate(sampleRate);
 			mReverbBufferPtrVector[channelIndex]->setSize(2, samplesPerBlock);
 			mSynthesiserBufferPtrVector[channelIndex]->setSize(2, samplesPerBlock);
+			mSynthesiserMidiBuffers[channelIndex].ensureSize(Samples::midiBufferBytesPerChannel);
 
 			mReverbGains[channelIndex]->prepare(spec);
-			mReverbs[channelIndex]->prepare(spec);
 
 			const auto reverbGainId = stringsJoinAndSnakeCase({ channelId, AudioParameters::gainComponentId });
 			const float reverbGainValue = mAudioProcessorValueTreeStatePtr->getParameterAsValue(reverbGainId).getValue();
 			mReverbGains[channelIndex]->setGainDecibels(reverbGainValue);
-
-			mReverbs[channelIndex]->setParameters({
-				mAudioProcessorValueTreeStatePtr->getParameterAsValue(AudioParameters::roomSizeComponentId).getValue(),
-				mAudioProcessorValueTreeStatePtr->getParameterAsValue(AudioParameters::dampingComponentId).getValue(),
-				1.0f,
-				0.0f,
-				mAudioProcessorValueTreeStatePtr->getParameterAsValue(AudioParameters::widthComponentId).getValue(),
-				0.0f });
 		}
 
 		const auto& compressor = mCompressors[channelIndex];
@@ -532,8 +846,7 @@ void PluginAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 		const auto lowShelfGainId = stringsJoinAndSnakeCase({ channelId, AudioParameters::lowShelfEqualizationTypeId, AudioParameters::gainComponentId });
 		const float lowShelfGain = mAudioProcessorValueTreeStatePtr->getParameterAsValue(lowShelfGainId).getValue();
 
-		mLowShelfFilters[channelIndex].prepare(spec);
-		*mLowShelfFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makeLowShelf(sampleRate, lowShelfCenterFrequency, lowShelfQuality, lowShelfGain);
+		mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::lowShelf, *juce::dsp::IIR::Coefficients<float>::makeLowShelf(sampleRate, lowShelfCenterFrequency, lowShelfQuality, lowShelfGain));
 
 		// EQ - Peak Filter
 		const auto peakFilterCenterFrequencyId = stringsJoinAndSnakeCase({ channelId, AudioParameters::peakFilterEqualizationTypeId, AudioParameters::frequencyComponentId });
@@ -545,8 +858,7 @@ void PluginAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 		const auto peakFilterGainId = stringsJoinAndSnakeCase({ channelId, AudioParameters::peakFilterEqualizationTypeId, AudioParameters::gainComponentId });
 		const float peakFilterGain = mAudioProcessorValueTreeStatePtr->getParameterAsValue(peakFilterGainId).getValue();
 
-		mPeakFilters[channelIndex].prepare(spec);
-		*mPeakFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makePeakFilter(sampleRate, peakFilterCenterFrequency, peakFilterQuality, peakFilterGain);
+		mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::peakFilter, *juce::dsp::IIR::Coefficients<float>::makePeakFilter(sampleRate, peakFilterCenterFrequency, peakFilterQuality, peakFilterGain));
 
 		// EQ - High Shelf
 		const auto highShelfFrequencyId = stringsJoinAndSnakeCase({ channelId, AudioParameters::highShelfEqualizationTypeId, AudioParameters::frequencyComponentId });
@@ -558,8 +870,7 @@ void PluginAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 		const auto highShelfGainId = stringsJoinAndSnakeCase({ channelId, AudioParameters::highShelfEqualizationTypeId, AudioParameters::gainComponentId });
 		const float highShelfGain = mAudioProcessorValueTreeStatePtr->getParameterAsValue(highShelfGainId).getValue();
 
-		mHighShelfFilters[channelIndex].prepare(spec);
-		*mHighShelfFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makeHighShelf(sampleRate, highShelfCenterFrequency, highShelfQuality, highShelfGain);
+		mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::highShelf, *juce::dsp::IIR::Coefficients<float>::makeHighShelf(sampleRate, highShelfCenterFrequency, highShelfQuality, highShelfGain));
 
 		const auto channelGainId = stringsJoinAndSnakeCase({ channelId, AudioParameters::gainComponentId });
 		const float channelGainValue = mAudioProcessorValueTreeStatePtr->getParameterAsValue(channelGainId).getValue();
@@ -567,6 +878,18 @@ void PluginAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 		mChannelGains[channelIndex]->setGainDecibels(channelGainValue);
 	}
 
+	if (mChannelWorkersPtr != nullptr)
+	{
+		mChannelWorkersPtr->prepare(sampleRate, samplesPerBlock);
+	}
+}
+
+void PluginAudioProcessor::audioWorkgroupContextChanged(const juce::AudioWorkgroup& workgroup)
+{
+	if (mChannelWorkersPtr != nullptr)
+	{
+		mChannelWorkersPtr->setWorkgroup(workgroup);
+	}
 }
 
 void PluginAudioProcessor::releaseResources()
@@ -611,32 +934,28 @@ void PluginAudioProcessor::processBlock(juce::AudioBuffer<float>& outputBuffer,
 
 	mRoomBufferPtr->clear();
 
-	for (const auto& channel : Channels::channelIndexToIdMap) {
-		const auto channelIndex = channel.first;
-		const auto& channelId = channel.second;
+	routeMidiMessages(midiMessages);
+	routeAuditions(outputBuffer.getNumSamples());
 
-		if (channelIndex == Channels::outputChannelIndex || channelIndex == Channels::roomChannelIndex) {
-			break;
+	// The drum channel strips are independent, only summing them into the room and the
+	// outputs has to wait until all of them are done.
+	if (mChannelWorkersPtr != nullptr)
+	{
+		mChannelWorkersPtr->process();
+	}
+	else
+	{
+		for (int channelIndex = 0; channelIndex < Channels::roomChannelIndex; channelIndex++)
+		{
+			processChannel(channelIndex);
 		}
+	}
 
-		auto& synthesiser = mSynthesiserPtrVector[channelIndex];
-		auto& internalBufferPtr = mSynthesiserBufferPtrVector[channelIndex];
-		internalBufferPtr->clear();
-		synthesiser->renderNextBlock(*internalBufferPtr, midiMessages, 0, internalBufferPtr->getNumSamples());
-
-		// Reverb
-
+	for (int channelIndex = 0; channelIndex < Channels::roomChannelIndex; channelIndex++)
+	{
+		const auto& internalBufferPtr = mSynthesiserBufferPtrVector[channelIndex];
 		const auto& reverbBufferPtr = mReverbBufferPtrVector[channelIndex];
 
-		reverbBufferPtr->copyFrom(0, 0, internalBufferPtr->getReadPointer(0), internalBufferPtr->getNumSamples());
-		reverbBufferPtr->copyFrom(1, 0, internalBufferPtr->getReadPointer(1), internalBufferPtr->getNumSamples());
-
-		juce::dsp::AudioBlock<float> reverbBufferBlock(*reverbBufferPtr);
-		juce::dsp::ProcessContextReplacing<float> reverbBufferContext(reverbBufferBlock);
-
-		mReverbGains[channelIndex]->process(reverbBufferContext);
-		mReverbs[channelIndex]->process(reverbBufferContext);
-
 		mRoomBufferPtr->addFrom(
 			0,
 			0,
@@ -648,24 +967,6 @@ void PluginAudioProcessor::processBlock(juce::AudioBuffer<float>& outputBuffer,
 			reverbBufferPtr->getReadPointer(1),
 			reverbBufferPtr->getNumSamples());
 
-		// EQ/comp
-
-		juce::dsp::AudioBlock<float> internalBufferBlock(*internalBufferPtr);
-		juce::dsp::ProcessContextReplacing<float> internalBufferContext(internalBufferBlock);
-
-		mCompressorDryWetMixers[channelIndex]->pushDrySamples(internalBufferBlock);
-
-		mCompressors[channelIndex]->process(internalBufferContext);
-		mCompressorGains[channelIndex]->process(internalBufferContext);
-
-		mCompressorDryWetMixers[channelIndex]->mixWetSamples(internalBufferBlock);
-
-		mLowShelfFilters[channelIndex].process(internalBufferContext);
-		mPeakFilters[channelIndex].process(internalBufferContext);
-		mHighShelfFilters[channelIndex].process(internalBufferContext);
-
-		mChannelGains[channelIndex]->process(internalBufferContext);
-
 		outputBuffer.addFrom(
 			isMultiOut ? 2 + (channelIndex * 2) : 0,
 			0,
@@ -681,13 +982,24 @@ void PluginAudioProcessor::processBlock(juce::AudioBuffer<float>& outputBuffer,
 	juce::dsp::AudioBlock<float> roomBlock(*mRoomBufferPtr);
 	juce::dsp::ProcessContextReplacing<float> roomContext(roomBlock);
 
+	if (mRoomConvolutionPtr != nullptr)
+	{
+		mRoomConvolutionPtr->process(roomContext);
+	}
+	else if (mDenseRoomParameter->get())
+	{
+		mRoomFdnReverbPtr->process(roomContext);
+	}
+	else
+	{
+		mRoomReverbPtr->process(roomContext);
+	}
+
 	mCompressorDryWetMixers[Channels::roomChannelIndex]->pushDrySamples(roomBlock);
 	mCompressors[Channels::roomChannelIndex]->process(roomContext);
 	mCompressorGains[Channels::roomChannelIndex]->process(roomContext);
 	mCompressorDryWetMixers[Channels::roomChannelIndex]->mixWetSamples(roomBlock);
-	mLowShelfFilters[Channels::roomChannelIndex].process(roomContext);
-	mPeakFilters[Channels::roomChannelIndex].process(roomContext);
-	mHighShelfFilters[Channels::roomChannelIndex].process(roomContext);
+	mEqualizerBank.process(Channels::roomChannelIndex, roomBlock);
 	
 	mChannelGains[Channels::roomChannelIndex]->process(roomContext);
 
@@ -712,9 +1024,7 @@ void PluginAudioProcessor::processBlock(juce::AudioBuffer<float>& outputBuffer,
 	mCompressors[Channels::outputChannelIndex]->process(outputContext);
 	mCompressorGains[Channels::outputChannelIndex]->process(outputContext);
 	mCompressorDryWetMixers[Channels::outputChannelIndex]->mixWetSamples(outputBlock);
-	mLowShelfFilters[Channels::outputChannelIndex].process(outputContext);
-	mPeakFilters[Channels::outputChannelIndex].process(outputContext);
-	mHighShelfFilters[Channels::outputChannelIndex].process(outputContext);
+	mEqualizerBank.process(Channels::outputChannelIndex, outputBlock);
 	mChannelGains[Channels::outputChannelIndex]->process(outputContext);
 }
 
@@ -726,47 +1036,45 @@ void PluginAudioProcessor::parameterChanged(const juce::String& parameterId, flo
 
 	if (std::strcmp(parameterId.toRawUTF8(), AudioParameters::roomSizeComponentId.c_str()) == 0)
 	{
-		for (const auto& reverb : mReverbs)
-		{
-			const auto& parameters = reverb->getParameters();
-			reverb->setParameters({
-				newValue,
-				parameters.damping,
-				1.0f,
-				0.0f,
-				parameters.width,
-				0.0f });
-		}
+		const auto& parameters = mRoomReverbPtr->getParameters();
+		mRoomReverbPtr->setParameters({
+			newValue,
+			parameters.damping,
+			1.0f,
+			0.0f,
+			parameters.width,
+			0.0f });
 	}
 	
 	if (std::strcmp(parameterId.toRawUTF8(), AudioParameters::widthComponentId.c_str()) == 0)
 	{
-		for (const auto& reverb : mReverbs)
-		{
-			const auto& parameters = reverb->getParameters();
-			reverb->setParameters({
-				parameters.roomSize,
-				parameters.damping ,
-				1.0f,
-				0.0f,
-				newValue,
-				0.0f });
-		}
+		const auto& parameters = mRoomReverbPtr->getParameters();
+		mRoomReverbPtr->setParameters({
+			parameters.roomSize,
+			parameters.damping ,
+			1.0f,
+			0.0f,
+			newValue,
+			0.0f });
 	}
 
 	if (std::strcmp(parameterId.toRawUTF8(), AudioParameters::dampingComponentId.c_str()) == 0)
 	{
-		for (const auto& reverb : mReverbs)
-		{
-			const auto& parameters = reverb->getParameters();
-			reverb->setParameters({
-				parameters.roomSize,
-				newValue,
-				1.0f,
-				0.0f,
-				parameters.width,
-				0.0f });
-		}
+		const auto& parameters = mRoomReverbPtr->getParameters();
+		mRoomReverbPtr->setParameters({
+			parameters.roomSize,
+			newValue,
+			1.0f,
+			0.0f,
+			parameters.width,
+			0.0f });
+	}
+
+	if (std::strcmp(parameterId.toRawUTF8(), AudioParameters::roomSizeComponentId.c_str()) == 0
+		|| std::strcmp(parameterId.toRawUTF8(), AudioParameters::widthComponentId.c_str()) == 0
+		|| std::strcmp(parameterId.toRawUTF8(), AudioParameters::dampingComponentId.c_str()) == 0)
+	{
+		mRoomFdnReverbPtr->setParameters(mRoomReverbPtr->getParameters());
 	}
 
 	for (const auto& channel : Channels::channelIndexToIdMap) 
@@ -829,27 +1137,27 @@ void PluginAudioProcessor::parameterChanged(const juce::String& parameterId, flo
 
 		if (std::strcmp(parameterId.toRawUTF8(), lowShelfFrequencyId.c_str()) == 0) 
 		{
-			*mLowShelfFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makeLowShelf(
+			mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::lowShelf, *juce::dsp::IIR::Coefficients<float>::makeLowShelf(
 				sampleRate,
 				std::max(AudioParameters::frequencyMinimumValue, newValue),
 				std::max(AudioParameters::qualityMinimumValue, lowShelfQuality),
-				std::max(AudioParameters::gainDecibelsMinimumValue, lowShelfGain));
+				std::max(AudioParameters::gainDecibelsMinimumValue, lowShelfGain)));
 		}
 		else if (std::strcmp(parameterId.toRawUTF8(), lowShelfQualityId.c_str()) == 0) 
 		{
-			*mLowShelfFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makeLowShelf(
+			mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::lowShelf, *juce::dsp::IIR::Coefficients<float>::makeLowShelf(
 				sampleRate,
 				std::max(AudioParameters::frequencyMinimumValue, lowShelfCenterFrequency),
 				std::max(AudioParameters::qualityMinimumValue, newValue),
-				std::max(AudioParameters::gainDecibelsMinimumValue, lowShelfGain));
+				std::max(AudioParameters::gainDecibelsMinimumValue, lowShelfGain)));
 		}
 		else if (std::strcmp(parameterId.toRawUTF8(), lowShelfGainId.c_str()) == 0) 
 		{
-			*mLowShelfFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makeLowShelf(
+			mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::lowShelf, *juce::dsp::IIR::Coefficients<float>::makeLowShelf(
 				sampleRate,
 				std::max(AudioParameters::frequencyMinimumValue, lowShelfCenterFrequency),
 				std::max(AudioParameters::qualityMinimumValue, lowShelfQuality),
-				std::max(AudioParameters::gainDecibelsMinimumValue, newValue));
+				std::max(AudioParameters::gainDecibelsMinimumValue, newValue)));
 		}
 
 		const auto peakFilterCenterFrequencyId = stringsJoinAndSnakeCase({ channelId, AudioParameters::peakFilterEqualizationTypeId, AudioParameters::frequencyComponentId });
@@ -863,27 +1171,27 @@ void PluginAudioProcessor::parameterChanged(const juce::String& parameterId, flo
 
 		if (std::strcmp(parameterId.toRawUTF8(), peakFilterCenterFrequencyId.c_str()) == 0) 
 		{
-			*mPeakFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makePeakFilter(
+			mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::peakFilter, *juce::dsp::IIR::Coefficients<float>::makePeakFilter(
 				sampleRate,
 				std::max(AudioParameters::frequencyMinimumValue, newValue),
 				std::max(AudioParameters::qualityMinimumValue, peakFilterQuality),
-				std::max(AudioParameters::peakFilterGainMinimumValue, peakFilterGain));
+				std::max(AudioParameters::peakFilterGainMinimumValue, peakFilterGain)));
 		}
 		else if (std::strcmp(parameterId.toRawUTF8(), peakFilterQualityId.c_str()) == 0) 
 		{
-			*mPeakFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makePeakFilter(
+			mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::peakFilter, *juce::dsp::IIR::Coefficients<float>::makePeakFilter(
 				sampleRate,
 				std::max(AudioParameters::frequencyMinimumValue, peakFilterCenterFrequency),
 				std::max(AudioParameters::qualityMinimumValue, newValue),
-				std::max(AudioParameters::peakFilterGainMinimumValue, peakFilterGain));
+				std::max(AudioParameters::peakFilterGainMinimumValue, peakFilterGain)));
 		}
 		else if (std::strcmp(parameterId.toRawUTF8(), peakFilterGainId.c_str()) == 0) 
 		{
-			*mPeakFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makePeakFilter(
+			mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::peakFilter, *juce::dsp::IIR::Coefficients<float>::makePeakFilter(
 				sampleRate,
 				std::max(AudioParameters::frequencyMinimumValue, peakFilterCenterFrequency),
 				std::max(AudioParameters::qualityMinimumValue, peakFilterQuality),
-				std::max(AudioParameters::peakFilterGainMinimumValue, newValue));
+				std::max(AudioParameters::peakFilterGainMinimumValue, newValue)));
 		}
 
 		const auto highShelfFrequencyId = stringsJoinAndSnakeCase({ channelId, AudioParameters::highShelfEqualizationTypeId, AudioParameters::frequencyComponentId });
@@ -897,27 +1205,27 @@ void PluginAudioProcessor::parameterChanged(const juce::String& parameterId, flo
 
 		if (std::strcmp(parameterId.toRawUTF8(), highShelfFrequencyId.c_str()) == 0) 
 		{
-			*mHighShelfFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makeHighShelf(
+			mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::highShelf, *juce::dsp::IIR::Coefficients<float>::makeHighShelf(
 				sampleRate,
 				std::max(AudioParameters::frequencyMinimumValue, newValue),
 				std::max(AudioParameters::qualityMinimumValue, highShelfQuality),
-				std::max(AudioParameters::gainMinimumValue, highShelfGain));
+				std::max(AudioParameters::gainMinimumValue, highShelfGain)));
 		}
 		else if (std::strcmp(parameterId.toRawUTF8(), highShelfQualityId.c_str()) == 0) 
 		{
-			*mHighShelfFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makeHighShelf(
+			mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::highShelf, *juce::dsp::IIR::Coefficients<float>::makeHighShelf(
 				sampleRate,
 				std::max(AudioParameters::frequencyMinimumValue, highShelfCenterFrequency),
 				std::max(AudioParameters::qualityMinimumValue, newValue),
-				std::max(AudioParameters::gainMinimumValue, highShelfGain));
+				std::max(AudioParameters::gainMinimumValue, highShelfGain)));
 		}
 		else if (std::strcmp(parameterId.toRawUTF8(), highShelfGainId.c_str()) == 0) 
 		{
-			*mHighShelfFilters[channelIndex].state = *juce::dsp::IIR::Coefficients<float>::makeHighShelf(
+			mEqualizerBank.setCoefficients(channelIndex, PluginEqualizerBank::highShelf, *juce::dsp::IIR::Coefficients<float>::makeHighShelf(
 				sampleRate,
 				std::max(AudioParameters::frequencyMinimumValue, highShelfCenterFrequency),
 				std::max(AudioParameters::qualityMinimumValue, highShelfQuality),
-				std::max(AudioParameters::gainMinimumValue, newValue));
+				std::max(AudioParameters::gainMinimumValue, newValue)));
 		}
 
 		const auto compressorGainId = stringsJoinAndSnakeCase({ channelId, AudioParameters::compressionComponentId, AudioParameters::gainComponentId });
@@ -967,21 +1275,160 @@ juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 	return new PluginAudioProcessor();
 }
 
-void PluginAudioProcessor::noteOnSynthesisers(int midiNoteNumber, const float velocity)
+void PluginAudioProcessor::processChannel(const int channelIndex)
 {
-	for (const auto& synthesiser : mSynthesiserPtrVector)
+	auto& synthesiser = mSynthesiserPtrVector[channelIndex];
+	auto& internalBufferPtr = mSynthesiserBufferPtrVector[channelIndex];
+	internalBufferPtr->clear();
+
+	// Idle channels skip the synthesiser, their effects still run so tails ring out.
+	if (!mSynthesiserMidiBuffers[channelIndex].isEmpty() || synthesiser->hasActiveVoices())
+	{
+		synthesiser->renderNextBlock(*internalBufferPtr, mSynthesiserMidiBuffers[channelIndex], 0, internalBufferPtr->getNumSamples());
+	}
+
+	// Reverb
+
+	const bool isReverbPostFader = mReverbPostFaderParameters[channelIndex]->get();
+
+	if (!isReverbPostFader)
+	{
+		sendToRoom(channelIndex);
+	}
+
+	// EQ/comp
+
+	juce::dsp::AudioBlock<float> internalBufferBlock(*internalBufferPtr);
+	juce::dsp::ProcessContextReplacing<float> internalBufferContext(internalBufferBlock);
+
+	mCompressorDryWetMixers[channelIndex]->pushDrySamples(internalBufferBlock);
+
+	mCompressors[channelIndex]->process(internalBufferContext);
+	mCompressorGains[channelIndex]->process(internalBufferContext);
+
+	mCompressorDryWetMixers[channelIndex]->mixWetSamples(internalBufferBlock);
+
+	mEqualizerBank.process(channelIndex, internalBufferBlock);
+
+	mChannelGains[channelIndex]->process(internalBufferContext);
+
+	if (isReverbPostFader)
 	{
-		synthesiser->noteOn(0, midiNoteNumber, velocity);
+		sendToRoom(channelIndex);
 	}
 }
 
+void PluginAudioProcessor::sendToRoom(const int channelIndex)
+{
+	const auto& internalBufferPtr = mSynthesiserBufferPtrVector[channelIndex];
+	const auto& reverbBufferPtr = mReverbBufferPtrVector[channelIndex];
+
+	reverbBufferPtr->copyFrom(0, 0, internalBufferPtr->getReadPointer(0), internalBufferPtr->getNumSamples());
+	reverbBufferPtr->copyFrom(1, 0, internalBufferPtr->getReadPointer(1), internalBufferPtr->getNumSamples());
+
+	juce::dsp::AudioBlock<float> reverbBufferBlock(*reverbBufferPtr);
+	juce::dsp::ProcessContextReplacing<float> reverbBufferContext(reverbBufferBlock);
+
+	mReverbGains[channelIndex]->process(reverbBufferContext);
+}
+
+void PluginAudioProcessor::routeMidiMessages(const juce::MidiBuffer& midiMessages)
+{
+	for (auto& synthesiserMidiBuffer : mSynthesiserMidiBuffers)
+	{
+		synthesiserMidiBuffer.clear();
+	}
+
+	for (const auto metadata : midiMessages)
+	{
+		const auto message = metadata.getMessage();
+
+		if (message.isNoteOnOrOff())
+		{
+			const int channelIndex = mMidiNoteToChannelIndex[(size_t)message.getNoteNumber()];
+
+			if (channelIndex >= 0)
+			{
+				mSynthesiserMidiBuffers[channelIndex].addEvent(message, metadata.samplePosition);
+			}
+		}
+		else
+		{
+			// Controllers and all notes off concern every channel.
+			for (auto& synthesiserMidiBuffer : mSynthesiserMidiBuffers)
+			{
+				synthesiserMidiBuffer.addEvent(message, metadata.samplePosition);
+			}
+		}
+	}
+}
+
+void PluginAudioProcessor::routeAuditions(const int numSamples)
+{
+	mAuditionLoop.process(numSamples, getSampleRate(), [this](const int midiNote, const float velocity, const int samplePosition)
+		{
+			const int channelIndex = mMidiNoteToChannelIndex[(size_t)midiNote];
+
+			if (channelIndex >= 0)
+			{
+				mSynthesiserMidiBuffers[channelIndex].addEvent(juce::MidiMessage::noteOn(1, midiNote, velocity), samplePosition);
+			}
+		});
+
+	mAuditionQueue.drain([this](const PluginAuditionQueue::Event& event)
+		{
+			const int channelIndex = event.midiNote >= 0 && event.midiNote < 128 ? mMidiNoteToChannelIndex[(size_t)event.midiNote] : -1;
+
+			if (channelIndex < 0)
+			{
+				return;
+			}
+
+			if (event.micIndex < 0)
+			{
+				mSynthesiserMidiBuffers[channelIndex].addEvent(juce::MidiMessage::noteOn(1, event.midiNote, event.velocity), 0);
+			}
+			else
+			{
+				// A single mic has no MIDI equivalent, it is started on the audio thread before rendering.
+				mSynthesiserPtrVector[channelIndex]->noteOn(0, event.midiNote, event.velocity, event.micIndex);
+			}
+		});
+}
+
+void PluginAudioProcessor::noteOnSynthesisers(int midiNoteNumber, const float velocity)
+{
+	mAuditionQueue.push({ midiNoteNumber, velocity, -1 });
+}
 
 void PluginAudioProcessor::noteOnSynthesisers(int midiNoteNumber, const float velocity, std::string micId)
 {
-	for (const auto& synthesiser : mSynthesiserPtrVector)
+	const int channelIndex = midiNoteNumber >= 0 && midiNoteNumber < 128 ? mMidiNoteToChannelIndex[(size_t)midiNoteNumber] : -1;
+
+	if (channelIndex < 0)
 	{
-		synthesiser->noteOn(0, midiNoteNumber, velocity, micId);
+		return;
 	}
+
+	const int micIndex = mSynthesiserPtrVector[channelIndex]->getMicIndex(micId);
+
+	if (micIndex >= 0)
+	{
+		mAuditionQueue.push({ midiNoteNumber, velocity, micIndex });
+	}
+}
+
+void PluginAudioProcessor::startAuditionLoop(int midiNoteNumber, const float velocity, const double beatsPerMinute)
+{
+	if (midiNoteNumber >= 0 && midiNoteNumber < 128)
+	{
+		mAuditionLoop.start(midiNoteNumber, velocity, beatsPerMinute);
+	}
+}
+
+void PluginAudioProcessor::stopAuditionLoop()
+{
+	mAuditionLoop.stop();
 }
 
 PluginPresetManager& PluginAudioProcessor::getPresetManager()
@@ -3,6 +3,13 @@
 #include "Configuration/Samples.h"
 #include "Synthesiser/PluginSynthesiser.h"
 #include "PluginPresetManager.h"
+#include "PluginLoadTimings.h"
+#include "PluginAuditionQueue.h"
+#include "PluginAuditionLoop.h"
+#include "PluginChannelWorkers.h"
+#include "PluginFdnReverb.h"
+#include "PluginRoomConvolution.h"
+#include "PluginEqualizerBank.h"
 
 class PluginAudioProcessor : public juce::AudioProcessor, juce::AudioProcessorValueTreeState::Listener
 {
@@ -13,6 +20,7 @@ public:
 
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
 	void releaseResources() override;
+	void audioWorkgroupContextChanged(const juce::AudioWorkgroup& workgroup) override;
 
 #ifndef JucePlugin_PreferredChannelConfigurations
 	bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
@@ -41,27 +49,74 @@ public:
 	void getStateInformation(juce::MemoryBlock& destData) override;
 	void setStateInformation(const void* data, int sizeInBytes) override;
 
+	// Message thread only, the notes are queued and played from the next block.
 	void noteOnSynthesisers(int midiNoteNumber, float velocity);
 	void noteOnSynthesisers(int midiNoteNumber, float velocity, std::string micId);
+	void startAuditionLoop(int midiNoteNumber, float velocity, double beatsPerMinute = PluginAuditionLoop::defaultBeatsPerMinute);
+	void stopAuditionLoop();
 
 	std::vector<int> getMidiNotesVector();
 	juce::AudioProcessorValueTreeState& getParameterValueTreeState() const;
 
 	PluginPresetManager& getPresetManager();
-private:
 
+	float getSampleLoadingProgress() const;
+	bool isLoadingSamples() const;
+	int getStreamingUnderrunCount() const;
+	size_t getSampleMemorySize();
+	size_t getSharedSampleMemorySize(); // process-wide, across all instances
+	float getSampleCompressionRatio(); // resident float size over the size actually held
+	bool exportKitFile(const juce::File& file);
+	PluginLoadTimings& getLoadTimings();
+	std::map<int, PluginSynthesiser::TrimReport> getSampleTrimReports(); // per midi note, once loaded
+private:
+	struct SampleResource {
+		std::string resourceName;
+		const char* resourceData = nullptr;
+		int resourceDataSize = 0;
+		int midiNote = -1;
+		std::string micId;
+		int velocityIndex = 0;
+		int variationIndex = 0;
+		int kitFileEntryIndex = -1;
+		juce::RangedAudioParameter* gainParameter = nullptr;
+		juce::RangedAudioParameter* panParameter = nullptr;
+		juce::AudioParameterBool* phaseParameter = nullptr;
+	};
+
+	PluginLoadTimings mLoadTimings; // first, so the parameter layout can be timed
 	std::unique_ptr<juce::AudioFormatManager> mAudioFormatManagerPtr;
+	std::unique_ptr<juce::ThreadPool> mSampleLoaderThreadPoolPtr;
+	std::atomic<bool> mIsSampleLoadingCancelled { false };
+	std::atomic<int> mNumberOfSamplesLoaded { 0 };
+	int mNumberOfSamplesToLoad = 0;
+	std::atomic<int> mNumberOfInstrumentsToLoad { 0 };
+	float mLeadingSilenceGain = 0.0f; // 0 when leading silence is kept
+	float mTailFloorGain = 0.0f; // 0 when tails are kept
+	double mSampleLoadingStartMilliseconds = 0.0;
+	std::atomic<double> mResampleSampleRate { 0.0 }; // host rate the sample cache is being built for
 	std::unique_ptr<PluginPresetManager> mPresetManagerPtr;
 	std::unique_ptr<juce::AudioProcessorValueTreeState> mAudioProcessorValueTreeStatePtr;
 
+	juce::SharedResourcePointer<PluginSamplePool> mSamplePool; // decoded samples shared with other instances
+	std::unique_ptr<PluginKitFile> mKitFilePtr; // mapped kit, outlives the sounds that refer into it
+	std::unique_ptr<PluginSampleStreamer> mSampleStreamerPtr; // only when streaming is enabled
 	std::vector<std::unique_ptr<PluginSynthesiser>> mSynthesiserPtrVector; // 6 synths
 	std::vector<std::unique_ptr<juce::AudioBuffer<float>>> mSynthesiserBufferPtrVector; 
+	std::vector<juce::MidiBuffer> mSynthesiserMidiBuffers; // each block's events, routed to their channel
+	std::array<int, 128> mMidiNoteToChannelIndex; // -1 for notes without an instrument
+	PluginAuditionQueue mAuditionQueue; // editor note ons, drained by processBlock
+	PluginAuditionLoop mAuditionLoop;
 	
-	std::vector<std::unique_ptr<juce::dsp::Gain<float>>> mReverbGains; // 6 revs
-	std::vector<std::unique_ptr<juce::dsp::Reverb>> mReverbs;
+	std::vector<std::unique_ptr<juce::dsp::Gain<float>>> mReverbGains; // 6 room sends
 	std::vector<std::unique_ptr<juce::AudioBuffer<float>>> mReverbBufferPtrVector;
+	std::vector<juce::AudioParameterBool*> mReverbPostFaderParameters;
 
 	std::unique_ptr<juce::AudioBuffer<float>> mRoomBufferPtr;
+	std::unique_ptr<juce::dsp::Reverb> mRoomReverbPtr; // shared by every send, linear so one does the work of six
+	std::unique_ptr<PluginFdnReverb> mRoomFdnReverbPtr; // used instead of mRoomReverbPtr when dense_room is on
+	juce::AudioParameterBool* mDenseRoomParameter;
+	std::unique_ptr<PluginRoomConvolution> mRoomConvolutionPtr; // used instead of mRoomReverbPtr when the kit has a room impulse response
 
 	std::vector<std::unique_ptr<juce::dsp::Compressor<float>>> mCompressors; // 8 comps
 	std::vector<std::unique_ptr<juce::dsp::Gain<float>>> mCompressorGains;
@@ -69,14 +124,19 @@ private:
 
 	std::vector<std::unique_ptr<juce::dsp::Gain<float>>> mChannelGains;
 
-	std::vector<juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>,
-		juce::dsp::IIR::Coefficients<float>>> mLowShelfFilters;
-	std::vector<juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>,
-		juce::dsp::IIR::Coefficients<float>>> mPeakFilters;
-	std::vector<juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>,
-		juce::dsp::IIR::Coefficients<float>>> mHighShelfFilters;
+	PluginEqualizerBank mEqualizerBank; // low shelf, peak and high shelf of all 8 strips
+
+	std::unique_ptr<PluginChannelWorkers> mChannelWorkersPtr; // last, stopped before what the strips use
 
 	juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+	std::map<int, std::vector<SampleResource>> getBinaryDataSampleResources();
+	std::map<int, std::vector<SampleResource>> getKitFileSampleResources();
+	void loadSampleResources(std::map<int, std::vector<SampleResource>> midiNoteToSampleResources);
+	void resampleSamples(const double sampleRate);
+	void routeMidiMessages(const juce::MidiBuffer& midiMessages);
+	void routeAuditions(int numSamples);
+	void processChannel(int channelIndex); // one drum channel strip, from any thread
+	void sendToRoom(int channelIndex); // the channel's room send, summed and reverberated in processBlock
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginAudioProcessor)
 };
@@ -9,6 +9,8 @@
 PluginAudioProcessorEditor::PluginAudioProcessorEditor(PluginAudioProcessor& p)
 	: AudioProcessorEditor(&p), mAudioProcessor(p)
 {
+	PluginLoadTimings::ScopedPhase phase(mAudioProcessor.getLoadTimings(), "editor");
+
 	auto& apvts = mAudioProcessor.getParameterValueTreeState();
 
 	auto* multiOutParameter = dynamic_cast<juce::AudioParameterBool*>(apvts.getParameter(AudioParameters::multiOutComponentId));
@@ -27,6 +29,17 @@ PluginAudioProcessorEditor::PluginAudioProcessorEditor(PluginAudioProcessor& p)
 	mPresetComponentPtr.reset(new PresetComponent(mAudioProcessor.getPresetManager()));
 	addAndMakeVisible(*mPresetComponentPtr);
 
+	mSampleLoadingProgress = mAudioProcessor.getSampleLoadingProgress();
+	mSampleLoadingProgressBarPtr.reset(new juce::ProgressBar(mSampleLoadingProgress));
+	mSampleLoadingProgressBarPtr->setTextToDisplay(Strings::loadingSamples);
+	addChildComponent(mSampleLoadingProgressBarPtr.get());
+
+	if (mAudioProcessor.isLoadingSamples())
+	{
+		mSampleLoadingProgressBarPtr->setVisible(true);
+		startTimerHz(10);
+	}
+
 	setSize(750, 750);
 	setResizable(true, true);
 
@@ -43,14 +56,17 @@ PluginAudioProcessorEditor::PluginAudioProcessorEditor(PluginAudioProcessor& p)
 		})));
 
 	mOutputsComponentPtr.reset(new OutputsComponent(apvts, ([this](int midiNote, float midiVelocity) -> void {
-		mAudioProcessor.noteOnSynthesisers(midiNote, midiVelocity);
+		mAudioProcessor.startAuditionLoop(midiNote, midiVelocity);
+		}), ([this]() -> void {
+		mAudioProcessor.stopAuditionLoop();
 		})));
 
 	mReverbComponentPtr.reset(new ReverbComponent(
 		apvts,
 		AudioParameters::roomSizeComponentId,
 		AudioParameters::dampingComponentId,
-		AudioParameters::widthComponentId));
+		AudioParameters::widthComponentId,
+		AudioParameters::denseRoomComponentId));
 
 	mTabbedComponentPtr->addTab(Strings::samples, juce::Colours::lightgrey, mSamplesComponentPtr.get(), true);
 	mTabbedComponentPtr->addTab(Strings::outputs, juce::Colours::lightgrey, mOutputsComponentPtr.get(), true);
@@ -59,6 +75,7 @@ PluginAudioProcessorEditor::PluginAudioProcessorEditor(PluginAudioProcessor& p)
 
 PluginAudioProcessorEditor::~PluginAudioProcessorEditor()
 {
+	stopTimer();
 	mMultiOutAttachment.reset();
 }
 
@@ -74,7 +91,25 @@ void PluginAudioProcessorEditor::resized()
 	auto topAreaBounds = localBounds.removeFromTop(64).reduced(4);
 
 	mMultiOutToggleButton->setBounds(topAreaBounds.removeFromRight(82));
+
+	if (mSampleLoadingProgressBarPtr->isVisible())
+	{
+		mSampleLoadingProgressBarPtr->setBounds(topAreaBounds.removeFromRight(128).reduced(4, 16));
+	}
+
 	mPresetComponentPtr->setBounds(topAreaBounds);
 	
 	mTabbedComponentPtr->setBounds(localBounds);
 }
+
+void PluginAudioProcessorEditor::timerCallback()
+{
+	mSampleLoadingProgress = mAudioProcessor.getSampleLoadingProgress();
+
+	if (!mAudioProcessor.isLoadingSamples())
+	{
+		stopTimer();
+		mSampleLoadingProgressBarPtr->setVisible(false);
+		resized();
+	}
+}
@@ -8,7 +8,7 @@
 #include "Components/OutputsComponent.h"
 #include "Components/ReverbComponent.h"
 
-class PluginAudioProcessorEditor : public juce::AudioProcessorEditor
+class PluginAudioProcessorEditor : public juce::AudioProcessorEditor, private juce::Timer
 {
 public:
     PluginAudioProcessorEditor(PluginAudioProcessor&);
@@ -16,6 +16,8 @@ public:
     void paint(juce::Graphics&) override;
     void resized() override;
 private:
+    void timerCallback() override;
+
     PluginAudioProcessor& mAudioProcessor;
     
     std::unique_ptr<juce::TabbedComponent> mTabbedComponentPtr;
@@ -27,5 +29,8 @@ private:
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> mMultiOutAttachment;
     std::unique_ptr<juce::ToggleButton> mMultiOutToggleButton;
     
+    double mSampleLoadingProgress = 0.0;
+    std::unique_ptr<juce::ProgressBar> mSampleLoadingProgressBarPtr;
+    
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginAudioProcessorEditor)
 };
@@ -0,0 +1,70 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+
+/*
+	Repeats an audition hit at a fixed tempo from the audio thread, so every hit lands on an
+	exact sample whatever the message thread is doing. The editor only starts and stops it.
+*/
+class PluginAuditionLoop
+{
+public:
+	static constexpr double defaultBeatsPerMinute = 60.0;
+
+	void start(const int midiNote, const float velocity, const double beatsPerMinute = defaultBeatsPerMinute)
+	{
+		mMidiNote.store(midiNote);
+		mVelocity.store(velocity);
+		mBeatsPerMinute.store(juce::jmax(1.0, beatsPerMinute));
+		mGeneration.fetch_add(1, std::memory_order_release);
+	}
+
+	void stop()
+	{
+		mMidiNote.store(-1);
+		mGeneration.fetch_add(1, std::memory_order_release);
+	}
+
+	bool isPlaying() const { return mMidiNote.load() >= 0; }
+
+	// Audio thread. Calls onHit(midiNote, velocity, samplePosition) for every hit in the block,
+	// the first one at the start of the block following start().
+	template <typename Callback>
+	void process(const int numSamples, const double sampleRate, Callback&& onHit)
+	{
+		const int generation = mGeneration.load(std::memory_order_acquire);
+
+		if (generation != mProcessedGeneration)
+		{
+			mProcessedGeneration = generation;
+			mSamplesToNextHit = 0.0;
+		}
+
+		const int midiNote = mMidiNote.load();
+
+		if (midiNote < 0 || sampleRate <= 0.0)
+		{
+			return;
+		}
+
+		const float velocity = mVelocity.load();
+		const double samplesPerHit = sampleRate * 60.0 / mBeatsPerMinute.load();
+
+		while (mSamplesToNextHit < numSamples)
+		{
+			onHit(midiNote, velocity, (int)mSamplesToNextHit);
+			mSamplesToNextHit += samplesPerHit;
+		}
+
+		mSamplesToNextHit -= numSamples;
+	}
+
+private:
+	std::atomic<int> mMidiNote { -1 };
+	std::atomic<float> mVelocity { 0.0f };
+	std::atomic<double> mBeatsPerMinute { defaultBeatsPerMinute };
+	std::atomic<int> mGeneration { 0 };
+
+	int mProcessedGeneration = 0; // audio thread only
+	double mSamplesToNextHit = 0.0; // kept fractional so the tempo does not drift
+};
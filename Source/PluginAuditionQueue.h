@@ -0,0 +1,49 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+
+/*
+	Auditions triggered from the editor, handed over to the audio thread without locking.
+	The message thread is the only producer and processBlock the only consumer.
+*/
+class PluginAuditionQueue
+{
+public:
+	static constexpr int capacity = 256;
+
+	struct Event {
+		int midiNote = 0;
+		float velocity = 0.0f;
+		int micIndex = -1; // every mic of the hit when negative
+	};
+
+	bool push(const Event& event) // false, dropping the audition, when the queue is full
+	{
+		const auto scope = mFifo.write(1);
+
+		if (scope.blockSize1 > 0)
+		{
+			mEvents[(size_t)scope.startIndex1] = event;
+			return true;
+		}
+
+		if (scope.blockSize2 > 0)
+		{
+			mEvents[(size_t)scope.startIndex2] = event;
+			return true;
+		}
+
+		return false;
+	}
+
+	template <typename Callback>
+	void drain(Callback&& callback)
+	{
+		const auto scope = mFifo.read(mFifo.getNumReady());
+		scope.forEach([&](const int eventIndex) { callback(mEvents[(size_t)eventIndex]); });
+	}
+
+private:
+	juce::AbstractFifo mFifo { capacity };
+	std::array<Event, capacity> mEvents;
+};
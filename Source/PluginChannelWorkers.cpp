@@ -0,0 +1,154 @@
+#include "PluginChannelWorkers.h"
+
+PluginChannelWorkers::PluginChannelWorkers(const int numberOfWorkers, const int numberOfJobs, std::function<void(int)> job)
+	: mJob(std::move(job)),
+	mJobStates((size_t)numberOfJobs),
+	mSpinTicks(juce::Time::secondsToHighResolutionTicks(spinMilliseconds / 1000.0))
+{
+	for (auto& jobState : mJobStates)
+	{
+		jobState.store(jobIdle, std::memory_order_relaxed);
+	}
+
+	for (int workerIndex = 0; workerIndex < numberOfWorkers; workerIndex++)
+	{
+		mWorkers.push_back(std::make_unique<Worker>(*this));
+	}
+}
+
+PluginChannelWorkers::~PluginChannelWorkers()
+{
+	stopWorkers();
+}
+
+void PluginChannelWorkers::prepare(const double sampleRate, const int maximumBlockSize)
+{
+	stopWorkers();
+
+	const auto realtimeOptions = juce::Thread::RealtimeOptions{}.withApproximateAudioProcessingTime(maximumBlockSize, sampleRate);
+
+	for (auto& worker : mWorkers)
+	{
+		if (!worker->startRealtimeThread(realtimeOptions))
+		{
+			DBG("channel worker could not start as a real-time thread");
+			worker->startThread(juce::Thread::Priority::highest);
+		}
+	}
+}
+
+void PluginChannelWorkers::setWorkgroup(const juce::AudioWorkgroup& workgroup)
+{
+	const juce::ScopedLock sl(mWorkgroupLock);
+	mWorkgroup = workgroup;
+	mWorkgroupGeneration.fetch_add(1, std::memory_order_release);
+}
+
+void PluginChannelWorkers::process()
+{
+	for (auto& jobState : mJobStates)
+	{
+		jobState.store(jobPending, std::memory_order_release);
+	}
+
+	// Seen by a worker either before it sleeps or through the notify.
+	mBlockGeneration.fetch_add(1, std::memory_order_seq_cst);
+
+	if (mNumberOfSleepingWorkers.load(std::memory_order_seq_cst) > 0)
+	{
+		for (auto& worker : mWorkers)
+		{
+			worker->notify();
+		}
+	}
+
+	// Takes whatever no worker has claimed yet, so only jobs already running are waited for.
+	runPendingJobs();
+
+	for (auto& jobState : mJobStates)
+	{
+		while (jobState.load(std::memory_order_acquire) != jobIdle)
+		{
+		}
+	}
+}
+
+void PluginChannelWorkers::runPendingJobs()
+{
+	for (auto& jobState : mJobStates)
+	{
+		int expectedState = jobPending;
+
+		if (jobState.compare_exchange_strong(expectedState, jobRunning, std::memory_order_acq_rel))
+		{
+			mJob((int)(&jobState - mJobStates.data()));
+			jobState.store(jobIdle, std::memory_order_release);
+		}
+	}
+}
+
+void PluginChannelWorkers::stopWorkers()
+{
+	for (auto& worker : mWorkers)
+	{
+		worker->signalThreadShouldExit();
+		worker->notify();
+	}
+
+	for (auto& worker : mWorkers)
+	{
+		worker->stopThread(1000);
+	}
+}
+
+PluginChannelWorkers::Worker::Worker(PluginChannelWorkers& owner)
+	: juce::Thread("channel worker"), mOwner(owner)
+{
+}
+
+void PluginChannelWorkers::Worker::run()
+{
+	juce::ScopedNoDenormals noDenormals;
+	juce::WorkgroupToken workgroupToken;
+	int workgroupGeneration = -1;
+	int blockGeneration = mOwner.mBlockGeneration.load(std::memory_order_acquire);
+	juce::int64 spinEndTicks = 0;
+
+	while (!threadShouldExit())
+	{
+		const int ownerWorkgroupGeneration = mOwner.mWorkgroupGeneration.load(std::memory_order_acquire);
+
+		if (workgroupGeneration != ownerWorkgroupGeneration)
+		{
+			const juce::ScopedLock sl(mOwner.mWorkgroupLock);
+			workgroupToken.reset();
+
+			if (mOwner.mWorkgroup)
+			{
+				mOwner.mWorkgroup.join(workgroupToken);
+			}
+
+			workgroupGeneration = ownerWorkgroupGeneration;
+		}
+
+		const int ownerBlockGeneration = mOwner.mBlockGeneration.load(std::memory_order_acquire);
+
+		if (blockGeneration != ownerBlockGeneration)
+		{
+			blockGeneration = ownerBlockGeneration;
+			mOwner.runPendingJobs();
+			spinEndTicks = juce::Time::getHighResolutionTicks() + mOwner.mSpinTicks;
+		}
+		else if (juce::Time::getHighResolutionTicks() >= spinEndTicks)
+		{
+			mOwner.mNumberOfSleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+
+			if (mOwner.mBlockGeneration.load(std::memory_order_seq_cst) == blockGeneration)
+			{
+				wait(sleepMilliseconds);
+			}
+
+			mOwner.mNumberOfSleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+		}
+	}
+}
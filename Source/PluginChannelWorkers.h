@@ -0,0 +1,62 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/*
+	Optional helper threads that run the independent channel strips of a block alongside the
+	audio thread. Each job is claimed through its own atomic state, so the audio thread never
+	locks or allocates, and whatever the workers have not claimed it takes back and runs itself.
+
+	Workers are real-time threads sized for the host block and join the host's audio workgroup
+	when it provides one. Once nothing is left to claim, the audio thread waits only for the
+	jobs a worker is actually running, so a worker that has not woken up never holds up the
+	block and every strip is always mixed. Between blocks workers spin briefly, then sleep
+	until process() wakes them.
+*/
+class PluginChannelWorkers
+{
+public:
+	PluginChannelWorkers(int numberOfWorkers, int numberOfJobs, std::function<void(int)> job);
+	~PluginChannelWorkers();
+
+	void prepare(double sampleRate, int maximumBlockSize); // (re)starts the workers, not while processing
+	void setWorkgroup(const juce::AudioWorkgroup& workgroup);
+
+	void process(); // audio thread, returns once every job of the block has finished
+
+private:
+	class Worker : public juce::Thread
+	{
+	public:
+		Worker(PluginChannelWorkers& owner);
+		void run() override;
+
+	private:
+		PluginChannelWorkers& mOwner;
+	};
+
+	enum JobState { jobIdle, jobPending, jobRunning };
+
+	static constexpr double spinMilliseconds = 0.05; // after a block, before sleeping
+	static constexpr int sleepMilliseconds = 100;
+
+	std::function<void(int)> mJob;
+	std::vector<std::atomic<int>> mJobStates;
+	std::atomic<int> mBlockGeneration { 0 };
+	std::atomic<int> mNumberOfSleepingWorkers { 0 };
+	juce::int64 mSpinTicks;
+
+	juce::CriticalSection mWorkgroupLock;
+	juce::AudioWorkgroup mWorkgroup;
+	std::atomic<int> mWorkgroupGeneration { 0 };
+
+	std::vector<std::unique_ptr<Worker>> mWorkers;
+
+	void runPendingJobs();
+	void stopWorkers();
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginChannelWorkers)
+};
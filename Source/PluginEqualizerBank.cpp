@@ -0,0 +1,129 @@
+#include "PluginEqualizerBank.h"
+
+void PluginEqualizerBank::prepare(const int numberOfStrips, const int numberOfChannels)
+{
+	mNumberOfStrips = numberOfStrips;
+	mNumberOfChannels = numberOfChannels;
+
+	// A pass through filter until the strip's coefficients are set.
+	mLatestCoefficients.assign((size_t)(numberOfStrips * numberOfBands * numberOfCoefficients), 0.0f);
+
+	for (size_t filterIndex = 0; filterIndex < (size_t)(numberOfStrips * numberOfBands); filterIndex++)
+	{
+		mLatestCoefficients[filterIndex * numberOfCoefficients] = 1.0f;
+	}
+
+	const size_t stripSize = (size_t)(numberOfBands * numberOfCoefficients);
+	mCoefficients.resize(mLatestCoefficients.size() * numberOfCopies);
+
+	for (size_t copyIndex = 0; copyIndex < (size_t)(numberOfStrips * numberOfCopies); copyIndex++)
+	{
+		std::copy_n(mLatestCoefficients.begin(), stripSize, mCoefficients.begin() + (std::ptrdiff_t)(copyIndex * stripSize));
+	}
+
+	mReadCopies.assign((size_t)numberOfStrips, 0);
+	mWriteCopies.assign((size_t)numberOfStrips, 2);
+	mMiddleCopies.reset(new std::atomic<int>[(size_t)numberOfStrips]);
+
+	for (int stripIndex = 0; stripIndex < numberOfStrips; stripIndex++)
+	{
+		mMiddleCopies[(size_t)stripIndex].store(1, std::memory_order_relaxed);
+	}
+
+	mFirstStates.assign((size_t)(numberOfStrips * numberOfChannels * numberOfBands), 0.0f);
+	mSecondStates.assign(mFirstStates.size(), 0.0f);
+}
+
+void PluginEqualizerBank::reset()
+{
+	std::fill(mFirstStates.begin(), mFirstStates.end(), 0.0f);
+	std::fill(mSecondStates.begin(), mSecondStates.end(), 0.0f);
+}
+
+void PluginEqualizerBank::setCoefficients(const int stripIndex, const Band band, const juce::dsp::IIR::Coefficients<float>& coefficients)
+{
+	jassert(stripIndex < mNumberOfStrips);
+	jassert(coefficients.getFilterOrder() == 2);
+
+	const juce::SpinLock::ScopedLockType sl(mWriteLock);
+	const size_t stripSize = (size_t)(numberOfBands * numberOfCoefficients);
+	const float* source = coefficients.getRawCoefficients();
+	float* latest = &mLatestCoefficients[(size_t)stripIndex * stripSize];
+
+	std::copy_n(source, numberOfCoefficients, latest + band * numberOfCoefficients);
+
+	// Fill the writer's copy with the strip's whole set, then swap it in as the fresh middle.
+	int& writeCopy = mWriteCopies[(size_t)stripIndex];
+	std::copy_n(latest, stripSize, &mCoefficients[((size_t)stripIndex * numberOfCopies + (size_t)writeCopy) * stripSize]);
+	writeCopy = mMiddleCopies[(size_t)stripIndex].exchange(writeCopy | freshFlag, std::memory_order_acq_rel) & copyMask;
+}
+
+void PluginEqualizerBank::process(const int stripIndex, juce::dsp::AudioBlock<float>& block)
+{
+	jassert(stripIndex < mNumberOfStrips);
+	jassert((int)block.getNumChannels() <= mNumberOfChannels);
+
+	int& readCopy = mReadCopies[(size_t)stripIndex];
+
+	if ((mMiddleCopies[(size_t)stripIndex].load(std::memory_order_relaxed) & freshFlag) != 0)
+	{
+		readCopy = mMiddleCopies[(size_t)stripIndex].exchange(readCopy, std::memory_order_acq_rel) & copyMask;
+	}
+
+	const float* c = &mCoefficients[((size_t)stripIndex * numberOfCopies + (size_t)readCopy) * numberOfBands * numberOfCoefficients];
+
+	// Copied to locals so the compiler keeps them in registers across the sample loop.
+	const float lowB0 = c[0], lowB1 = c[1], lowB2 = c[2], lowA1 = c[3], lowA2 = c[4];
+	const float peakB0 = c[5], peakB1 = c[6], peakB2 = c[7], peakA1 = c[8], peakA2 = c[9];
+	const float highB0 = c[10], highB1 = c[11], highB2 = c[12], highA1 = c[13], highA2 = c[14];
+
+	const int numberOfChannels = juce::jmin((int)block.getNumChannels(), mNumberOfChannels);
+	const int numberOfSamples = (int)block.getNumSamples();
+
+	for (int channelIndex = 0; channelIndex < numberOfChannels; channelIndex++)
+	{
+		const size_t stateIndex = (size_t)((stripIndex * mNumberOfChannels + channelIndex) * numberOfBands);
+		float* firstStates = &mFirstStates[stateIndex];
+		float* secondStates = &mSecondStates[stateIndex];
+
+		float low1 = firstStates[lowShelf], low2 = secondStates[lowShelf];
+		float peak1 = firstStates[peakFilter], peak2 = secondStates[peakFilter];
+		float high1 = firstStates[highShelf], high2 = secondStates[highShelf];
+
+		float* samples = block.getChannelPointer((size_t)channelIndex);
+
+		for (int sampleIndex = 0; sampleIndex < numberOfSamples; sampleIndex++)
+		{
+			const float input = samples[sampleIndex];
+
+			const float lowOutput = (lowB0 * input) + low1;
+			low1 = (lowB1 * input) - (lowA1 * lowOutput) + low2;
+			low2 = (lowB2 * input) - (lowA2 * lowOutput);
+
+			const float peakOutput = (peakB0 * lowOutput) + peak1;
+			peak1 = (peakB1 * lowOutput) - (peakA1 * peakOutput) + peak2;
+			peak2 = (peakB2 * lowOutput) - (peakA2 * peakOutput);
+
+			const float highOutput = (highB0 * peakOutput) + high1;
+			high1 = (highB1 * peakOutput) - (highA1 * highOutput) + high2;
+			high2 = (highB2 * peakOutput) - (highA2 * highOutput);
+
+			samples[sampleIndex] = highOutput;
+		}
+
+		// As juce::dsp::IIR::Filter does at the end of each block.
+		juce::dsp::util::snapToZero(low1);
+		juce::dsp::util::snapToZero(low2);
+		juce::dsp::util::snapToZero(peak1);
+		juce::dsp::util::snapToZero(peak2);
+		juce::dsp::util::snapToZero(high1);
+		juce::dsp::util::snapToZero(high2);
+
+		firstStates[lowShelf] = low1;
+		secondStates[lowShelf] = low2;
+		firstStates[peakFilter] = peak1;
+		secondStates[peakFilter] = peak2;
+		firstStates[highShelf] = high1;
+		secondStates[highShelf] = high2;
+	}
+}
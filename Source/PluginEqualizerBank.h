@@ -0,0 +1,55 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*
+	The low shelf, peak and high shelf biquads of every channel strip. Coefficients and state
+	are held as flat arrays indexed by strip and band (and audio channel for state), and a
+	strip's three bands run as one cascade per sample, so each block is read and written once
+	instead of three times. The arithmetic is the transposed direct form II of
+	juce::dsp::IIR::Filter, in the same order, so the output matches three chained filters.
+
+	Coefficients are published to the audio thread through three copies per strip: the writer
+	fills its own copy and swaps it into the middle, process() swaps a fresh middle copy for the
+	one it was reading. Neither side ever touches the copy the other holds.
+*/
+class PluginEqualizerBank
+{
+public:
+	enum Band
+	{
+		lowShelf,
+		peakFilter,
+		highShelf,
+		numberOfBands
+	};
+
+	void prepare(int numberOfStrips, int numberOfChannels);
+	void reset();
+
+	// Any thread, takes effect from the strip's next process().
+	void setCoefficients(int stripIndex, Band band, const juce::dsp::IIR::Coefficients<float>& coefficients);
+
+	void process(int stripIndex, juce::dsp::AudioBlock<float>& block);
+
+private:
+	static constexpr int numberOfCoefficients = 5; // b0, b1, b2, a1, a2 normalised by a0, as juce stores them
+	static constexpr int numberOfCopies = 3;
+	static constexpr int copyMask = 3;
+	static constexpr int freshFlag = 4; // set on the middle copy until process() takes it
+
+	int mNumberOfStrips = 0;
+	int mNumberOfChannels = 0;
+
+	std::vector<float> mCoefficients; // [strip][copy][band][coefficient]
+	std::vector<float> mLatestCoefficients; // [strip][band][coefficient], the writers' view
+	juce::SpinLock mWriteLock; // between writers only, process() never takes it
+	std::vector<int> mWriteCopies; // per strip, the copy the writer fills
+	std::vector<int> mReadCopies; // per strip, the copy process() reads
+	std::unique_ptr<std::atomic<int>[]> mMiddleCopies; // per strip, with freshFlag
+	std::vector<float> mFirstStates; // [strip][channel][band]
+	std::vector<float> mSecondStates;
+};
@@ -0,0 +1,202 @@
+#include "PluginFdnReverb.h"
+
+namespace
+{
+	// Mutually prime-ish line lengths, so the echoes of the lines do not pile up.
+	constexpr double delayMilliseconds[PluginFdnReverb::numberOfLines] = { 23.3, 29.1, 31.7, 37.3, 41.9, 47.3, 53.1, 59.3 };
+
+	constexpr double minimumDecaySeconds = 0.3;
+	constexpr double maximumDecaySeconds = 4.0;
+	constexpr float maximumDamping = 0.8f;
+	constexpr float inputGain = 0.25f;
+	// Matches the impulse response energy of juce::dsp::Reverb at the default room size and
+	// damping, and stays within half a decibel of it up to a room size of 0.75.
+	constexpr float wetScale = 3.3f;
+	constexpr float dryScale = 2.0f; // as juce::dsp::Reverb
+
+	constexpr int scratchChannel = PluginFdnReverb::numberOfLines;
+	constexpr int inputLeftChannel = PluginFdnReverb::numberOfLines + 1;
+	constexpr int inputRightChannel = PluginFdnReverb::numberOfLines + 2;
+}
+
+void PluginFdnReverb::setParameters(const juce::dsp::Reverb::Parameters& parameters)
+{
+	mParameters = parameters;
+	updateCoefficients();
+}
+
+void PluginFdnReverb::prepare(const juce::dsp::ProcessSpec& spec)
+{
+	mSampleRate = spec.sampleRate;
+
+	int longestDelay = 0;
+	int shortestDelay = std::numeric_limits<int>::max();
+
+	for (int line = 0; line < numberOfLines; line++)
+	{
+		mDelayLengths[(size_t)line] = juce::jmax(1, juce::roundToInt(delayMilliseconds[line] * mSampleRate / 1000.0));
+		longestDelay = juce::jmax(longestDelay, mDelayLengths[(size_t)line]);
+		shortestDelay = juce::jmin(shortestDelay, mDelayLengths[(size_t)line]);
+	}
+
+	// A chunk only reads frames written before it started.
+	mChunkLength = juce::jmin(maximumChunkLength, shortestDelay);
+
+	const int delayLineLength = juce::nextPowerOfTwo(longestDelay + mChunkLength);
+	mDelayLineMask = delayLineLength - 1;
+	mDelayLines.setSize(numberOfLines, delayLineLength);
+	mChunkFrames.setSize(numberOfLines + 3, mChunkLength);
+
+	updateCoefficients();
+	reset();
+}
+
+void PluginFdnReverb::reset()
+{
+	mDelayLines.clear();
+	mDampingStates.fill(0.0f);
+	mWritePosition = 0;
+}
+
+void PluginFdnReverb::updateCoefficients()
+{
+	const double decaySeconds = minimumDecaySeconds + (maximumDecaySeconds - minimumDecaySeconds) * mParameters.roomSize * mParameters.roomSize;
+	const float hadamardScale = 1.0f / std::sqrt((float)numberOfLines);
+
+	for (int line = 0; line < numberOfLines; line++)
+	{
+		// -60 dB after decaySeconds
+		mLoopGains[(size_t)line] = (float)std::pow(10.0, -3.0 * mDelayLengths[(size_t)line] / (decaySeconds * mSampleRate)) * hadamardScale;
+	}
+
+	mDampingCoefficient = mParameters.damping * maximumDamping;
+}
+
+void PluginFdnReverb::process(const juce::dsp::ProcessContextReplacing<float>& context)
+{
+	auto& block = context.getOutputBlock();
+
+	if (block.getNumChannels() == 0 || mDelayLines.getNumSamples() == 0)
+	{
+		return;
+	}
+
+	float* left = block.getChannelPointer(0);
+	float* right = block.getNumChannels() > 1 ? block.getChannelPointer(1) : nullptr;
+	const int numberOfFrames = (int)block.getNumSamples();
+
+	for (int chunkStart = 0; chunkStart < numberOfFrames; chunkStart += mChunkLength)
+	{
+		processChunk(left + chunkStart, right != nullptr ? right + chunkStart : nullptr, juce::jmin(mChunkLength, numberOfFrames - chunkStart));
+	}
+}
+
+void PluginFdnReverb::processChunk(float* left, float* right, const int numberOfFrames)
+{
+	float* scratch = mChunkFrames.getWritePointer(scratchChannel);
+	float* inputLeft = mChunkFrames.getWritePointer(inputLeftChannel);
+	float* inputRight = mChunkFrames.getWritePointer(inputRightChannel);
+
+	juce::FloatVectorOperations::copy(inputLeft, left, numberOfFrames);
+	juce::FloatVectorOperations::copy(inputRight, right != nullptr ? right : left, numberOfFrames);
+
+	// Line outputs
+
+	for (int line = 0; line < numberOfLines; line++)
+	{
+		const int readPosition = (mWritePosition - mDelayLengths[(size_t)line]) & mDelayLineMask;
+		const int firstLength = juce::jmin(numberOfFrames, mDelayLineMask + 1 - readPosition);
+
+		float* lineFrames = mChunkFrames.getWritePointer(line);
+		const float* delayLine = mDelayLines.getReadPointer(line);
+
+		juce::FloatVectorOperations::copy(lineFrames, delayLine + readPosition, firstLength);
+		juce::FloatVectorOperations::copy(lineFrames + firstLength, delayLine, numberOfFrames - firstLength);
+	}
+
+	// Even lines feed the left output, odd ones the right, mixed across by width as Freeverb does.
+
+	const float wet = mParameters.wetLevel * wetScale;
+	const float wetSame = 0.5f * wet * (1.0f + mParameters.width);
+	const float wetOther = 0.5f * wet * (1.0f - mParameters.width);
+	const float dry = mParameters.dryLevel * dryScale;
+
+	juce::FloatVectorOperations::copy(scratch, mChunkFrames.getReadPointer(0), numberOfFrames);
+	juce::FloatVectorOperations::copy(left, mChunkFrames.getReadPointer(1), numberOfFrames);
+
+	for (int line = 2; line < numberOfLines; line += 2)
+	{
+		juce::FloatVectorOperations::add(scratch, mChunkFrames.getReadPointer(line), numberOfFrames);
+		juce::FloatVectorOperations::add(left, mChunkFrames.getReadPointer(line + 1), numberOfFrames);
+	}
+
+	// scratch holds the even sum and left the odd sum.
+	if (right != nullptr)
+	{
+		juce::FloatVectorOperations::multiply(right, left, wetSame, numberOfFrames);
+		juce::FloatVectorOperations::addWithMultiply(right, scratch, wetOther, numberOfFrames);
+		juce::FloatVectorOperations::multiply(left, wetOther, numberOfFrames);
+		juce::FloatVectorOperations::addWithMultiply(left, scratch, wetSame, numberOfFrames);
+		juce::FloatVectorOperations::addWithMultiply(right, inputRight, dry, numberOfFrames);
+	}
+	else
+	{
+		juce::FloatVectorOperations::add(left, scratch, numberOfFrames);
+		juce::FloatVectorOperations::multiply(left, 0.5f * wet, numberOfFrames);
+	}
+
+	juce::FloatVectorOperations::addWithMultiply(left, inputLeft, dry, numberOfFrames);
+
+	// Damping and decay. The one pole low pass is recursive in time, so it stays scalar.
+
+	for (int line = 0; line < numberOfLines; line++)
+	{
+		float* lineFrames = mChunkFrames.getWritePointer(line);
+		float state = mDampingStates[(size_t)line];
+
+		for (int frame = 0; frame < numberOfFrames; frame++)
+		{
+			state = lineFrames[frame] + mDampingCoefficient * (state - lineFrames[frame]);
+			lineFrames[frame] = state;
+		}
+
+		mDampingStates[(size_t)line] = state;
+		juce::FloatVectorOperations::multiply(lineFrames, mLoopGains[(size_t)line], numberOfFrames);
+	}
+
+	// Fast Walsh-Hadamard mix, in place.
+
+	for (int span = 1; span < numberOfLines; span *= 2)
+	{
+		for (int first = 0; first < numberOfLines; first += 2 * span)
+		{
+			for (int line = first; line < first + span; line++)
+			{
+				float* a = mChunkFrames.getWritePointer(line);
+				float* b = mChunkFrames.getWritePointer(line + span);
+
+				juce::FloatVectorOperations::copy(scratch, a, numberOfFrames);
+				juce::FloatVectorOperations::add(a, b, numberOfFrames);
+				juce::FloatVectorOperations::subtract(b, scratch, b, numberOfFrames);
+			}
+		}
+	}
+
+	// Input, alternating sides and signs so the lines start out decorrelated, then back into the lines.
+
+	for (int line = 0; line < numberOfLines; line++)
+	{
+		float* lineFrames = mChunkFrames.getWritePointer(line);
+		const float lineInputGain = (line & 2) == 0 ? inputGain : -inputGain;
+
+		juce::FloatVectorOperations::addWithMultiply(lineFrames, (line & 1) == 0 ? inputLeft : inputRight, lineInputGain, numberOfFrames);
+
+		const int firstLength = juce::jmin(numberOfFrames, mDelayLineMask + 1 - mWritePosition);
+		float* delayLine = mDelayLines.getWritePointer(line);
+
+		juce::FloatVectorOperations::copy(delayLine + mWritePosition, lineFrames, firstLength);
+		juce::FloatVectorOperations::copy(delayLine, lineFrames + firstLength, numberOfFrames - firstLength);
+	}
+
+	mWritePosition = (mWritePosition + numberOfFrames) & mDelayLineMask;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+
+/*
+	Eight line feedback delay network, a denser and cheaper alternative to juce::dsp::Reverb
+	driven by the same parameters: room size sets the decay time, damping the high frequency
+	loss in the loop and width the stereo spread. Frames are processed a chunk at a time,
+	chunks never longer than the shortest line, so the Hadamard mix, loop gains and input and
+	output sums all run as vector operations across the chunk.
+*/
+class PluginFdnReverb
+{
+public:
+	static constexpr int numberOfLines = 8; // a power of two, for the Hadamard mix
+
+	void setParameters(const juce::dsp::Reverb::Parameters& parameters);
+	const juce::dsp::Reverb::Parameters& getParameters() const noexcept { return mParameters; }
+
+	void prepare(const juce::dsp::ProcessSpec& spec);
+	void reset();
+	void process(const juce::dsp::ProcessContextReplacing<float>& context);
+
+private:
+	static constexpr int maximumChunkLength = 256;
+
+	juce::dsp::Reverb::Parameters mParameters;
+	double mSampleRate = 44100.0;
+
+	std::array<int, numberOfLines> mDelayLengths {};
+	std::array<float, numberOfLines> mLoopGains {}; // decay over one trip round the line, Hadamard scaling included
+	std::array<float, numberOfLines> mDampingStates {};
+	float mDampingCoefficient = 0.0f;
+
+	juce::AudioBuffer<float> mDelayLines; // one channel per line, a power of two frames long
+	int mDelayLineMask = 0;
+	int mWritePosition = 0;
+	int mChunkLength = maximumChunkLength;
+
+	juce::AudioBuffer<float> mChunkFrames; // the lines' chunk, then scratch and the dry input
+
+	void updateCoefficients();
+	void processChunk(float* left, float* right, int numberOfFrames);
+};
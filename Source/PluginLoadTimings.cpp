@@ -0,0 +1,52 @@
+#include "PluginLoadTimings.h"
+
+const std::string PluginLoadTimings::logEnvironmentVariable = "PRO_PUNK_DRUMS_LOAD_TIMING_LOG";
+
+PluginLoadTimings::ScopedPhase::ScopedPhase(PluginLoadTimings& timings, const std::string& phaseName)
+	: mTimings(timings), mPhaseName(phaseName), mStartMilliseconds(getMillisecondCounter())
+{
+}
+
+PluginLoadTimings::ScopedPhase::~ScopedPhase()
+{
+	mTimings.record(mPhaseName, getMillisecondCounter() - mStartMilliseconds);
+}
+
+PluginLoadTimings::PluginLoadTimings()
+	: mIsLogging(juce::SystemStats::getEnvironmentVariable(logEnvironmentVariable, "").isNotEmpty())
+{
+}
+
+void PluginLoadTimings::record(const std::string& phaseName, const double milliseconds)
+{
+	{
+		const juce::ScopedLock sl(mLock);
+		mPhases.emplace_back(phaseName, milliseconds);
+	}
+
+	if (mIsLogging)
+	{
+		juce::Logger::writeToLog("load timing: " + juce::String(phaseName) + " " + juce::String(milliseconds, 3) + " ms");
+	}
+}
+
+std::vector<std::pair<std::string, double>> PluginLoadTimings::getPhases() const
+{
+	const juce::ScopedLock sl(mLock);
+	return mPhases;
+}
+
+double PluginLoadTimings::getPhaseMilliseconds(const std::string& phaseName) const
+{
+	const juce::ScopedLock sl(mLock);
+
+	for (const auto& phase : mPhases)
+	{
+		if (phase.first == phaseName)
+		{
+			return phase.second;
+		}
+	}
+
+	return -1.0;
+}
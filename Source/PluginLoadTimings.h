@@ -0,0 +1,42 @@
+#pragma once
+#include <JuceHeader.h>
+#include <string>
+#include <vector>
+
+/*
+	Wall clock time spent in each phase of bringing up a plugin instance, in the order
+	the phases finished. Setting PRO_PUNK_DRUMS_LOAD_TIMING_LOG also writes every phase
+	to the juce::Logger as it is recorded.
+*/
+class PluginLoadTimings
+{
+public:
+	static const std::string logEnvironmentVariable;
+
+	class ScopedPhase
+	{
+	public:
+		ScopedPhase(PluginLoadTimings& timings, const std::string& phaseName);
+		~ScopedPhase();
+
+	private:
+		PluginLoadTimings& mTimings;
+		std::string mPhaseName;
+		double mStartMilliseconds;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedPhase)
+	};
+
+	PluginLoadTimings();
+
+	static double getMillisecondCounter() { return juce::Time::getMillisecondCounterHiRes(); }
+
+	void record(const std::string& phaseName, double milliseconds);
+	std::vector<std::pair<std::string, double>> getPhases() const;
+	double getPhaseMilliseconds(const std::string& phaseName) const; // -1 until recorded
+
+private:
+	mutable juce::CriticalSection mLock;
+	std::vector<std::pair<std::string, double>> mPhases;
+	bool mIsLogging;
+};
@@ -0,0 +1,238 @@
+#include "PluginRoomConvolution.h"
+
+namespace
+{
+	constexpr int inputFifoBlocks = 8; // how far the background thread may fall behind before the audio thread catches up
+
+	void copyToFifo(const juce::dsp::AudioBlock<float>& block, juce::AbstractFifo& fifo, juce::AudioBuffer<float>& frames, const int numberOfFrames)
+	{
+		int start1, size1, start2, size2;
+		fifo.prepareToWrite(numberOfFrames, start1, size1, start2, size2);
+
+		for (int channel = 0; channel < frames.getNumChannels(); channel++)
+		{
+			const float* source = block.getChannelPointer((size_t)channel);
+			juce::FloatVectorOperations::copy(frames.getWritePointer(channel, start1), source, size1);
+			juce::FloatVectorOperations::copy(frames.getWritePointer(channel, start2), source + size1, size2);
+		}
+
+		fifo.finishedWrite(size1 + size2);
+	}
+}
+
+PluginRoomConvolution::PluginRoomConvolution(juce::AudioFormatReader& impulseResponseReader)
+	: juce::Thread("room convolution tail")
+{
+	const double impulseResponseSeconds = (double)impulseResponseReader.lengthInSamples / juce::jmax(1.0, impulseResponseReader.sampleRate);
+	mImpulseResponse = std::make_unique<PluginSampleData>(impulseResponseReader, impulseResponseSeconds + 1.0);
+}
+
+PluginRoomConvolution::~PluginRoomConvolution()
+{
+	signalThreadShouldExit();
+	notify();
+	stopThread(1000);
+}
+
+void PluginRoomConvolution::prepare(const juce::dsp::ProcessSpec& spec)
+{
+	signalThreadShouldExit();
+	notify();
+	stopThread(1000);
+
+	mMaximumBlockSize = (int)spec.maximumBlockSize;
+	mHeadLength = 0;
+	mTailLength = 0;
+
+	// Band-limited to the host rate here, so the head and tail split on an exact frame.
+	const auto* impulseResponse = mImpulseResponse->getResampled(spec.sampleRate);
+
+	if (impulseResponse == nullptr || impulseResponse->mLength == 0)
+	{
+		DBG("room impulse response could not be read");
+		return;
+	}
+
+	mHeadLength = juce::jmin(impulseResponse->mLength, Samples::roomConvolutionHeadBlocks * mMaximumBlockSize);
+	mTailLength = impulseResponse->mLength - mHeadLength;
+
+	auto getStereoFrames = [impulseResponse](const int startFrame, const int numberOfFrames)
+	{
+		juce::AudioBuffer<float> frames(2, numberOfFrames);
+
+		for (int channel = 0; channel < 2; channel++)
+		{
+			frames.copyFrom(channel, 0, *impulseResponse->mData, juce::jmin(channel, impulseResponse->mNumChannels - 1), startFrame, numberOfFrames);
+		}
+
+		return frames;
+	};
+
+	auto stereoSpec = spec;
+	stereoSpec.numChannels = 2;
+
+	// Loaded before prepare(), which then installs them without waiting for the loading thread.
+	mHeadConvolution.loadImpulseResponse(getStereoFrames(0, mHeadLength), spec.sampleRate, juce::dsp::Convolution::Stereo::yes, juce::dsp::Convolution::Trim::no, juce::dsp::Convolution::Normalise::no);
+	mHeadConvolution.prepare(stereoSpec);
+
+	if (mTailLength == 0)
+	{
+		return;
+	}
+
+	mTailConvolution.loadImpulseResponse(getStereoFrames(mHeadLength, mTailLength), spec.sampleRate, juce::dsp::Convolution::Stereo::yes, juce::dsp::Convolution::Trim::no, juce::dsp::Convolution::Normalise::no);
+	mTailConvolution.prepare(stereoSpec);
+
+	// A fifo of n frames holds n - 1. The output holds the head length of delay on top of
+	// whatever input is pending.
+	const int inputFifoSize = inputFifoBlocks * mMaximumBlockSize + 1;
+	mInputFrames.setSize(2, inputFifoSize);
+	mOutputFrames.setSize(2, mHeadLength + inputFifoSize);
+	mTailFrames.setSize(2, mMaximumBlockSize);
+
+	reset();
+
+	const auto realtimeOptions = juce::Thread::RealtimeOptions{}.withApproximateAudioProcessingTime(mMaximumBlockSize, spec.sampleRate);
+
+	if (!startRealtimeThread(realtimeOptions))
+	{
+		DBG("room convolution could not start as a real-time thread");
+		startThread(juce::Thread::Priority::highest);
+	}
+}
+
+void PluginRoomConvolution::reset()
+{
+	const juce::SpinLock::ScopedLockType lock(mTailLock);
+
+	mHeadConvolution.reset();
+	mTailConvolution.reset();
+
+	if (mTailLength == 0)
+	{
+		return;
+	}
+
+	mInputFifo.setTotalSize(mInputFrames.getNumSamples());
+	mOutputFifo.setTotalSize(mOutputFrames.getNumSamples());
+
+	// The tail starts a head length in: that much silence is mixed before its first frame.
+	mOutputFrames.clear();
+	int start1, size1, start2, size2;
+	mOutputFifo.prepareToWrite(mHeadLength, start1, size1, start2, size2);
+	mOutputFifo.finishedWrite(size1 + size2);
+}
+
+void PluginRoomConvolution::process(const juce::dsp::ProcessContextReplacing<float>& context)
+{
+	auto& block = context.getOutputBlock();
+	const int numberOfFrames = (int)block.getNumSamples();
+
+	if (mHeadLength == 0)
+	{
+		block.clear();
+		return;
+	}
+
+	if (mTailLength == 0)
+	{
+		mHeadConvolution.process(context);
+		return;
+	}
+
+	jassert(block.getNumChannels() == 2 && numberOfFrames <= mMaximumBlockSize);
+
+	if (mInputFifo.getFreeSpace() < numberOfFrames)
+	{
+		convolvePendingTail();
+	}
+
+	copyToFifo(block, mInputFifo, mInputFrames, numberOfFrames);
+	notify();
+
+	mHeadConvolution.process(context);
+
+	// The tail frames of this block come from input at least a head length old, already in
+	// the fifo; only a background thread that has fallen behind leaves them unconvolved.
+	if (mOutputFifo.getNumReady() < numberOfFrames)
+	{
+		convolvePendingTail();
+	}
+
+	int start1, size1, start2, size2;
+	mOutputFifo.prepareToRead(numberOfFrames, start1, size1, start2, size2);
+
+	for (int channel = 0; channel < 2; channel++)
+	{
+		float* destination = block.getChannelPointer((size_t)channel);
+		juce::FloatVectorOperations::add(destination, mOutputFrames.getReadPointer(channel, start1), size1);
+		juce::FloatVectorOperations::add(destination + size1, mOutputFrames.getReadPointer(channel, start2), size2);
+	}
+
+	mOutputFifo.finishedRead(size1 + size2);
+}
+
+bool PluginRoomConvolution::isReady() const noexcept
+{
+	return mHeadConvolution.getCurrentIRSize() == mHeadLength
+		&& (mTailLength == 0 || mTailConvolution.getCurrentIRSize() == mTailLength);
+}
+
+void PluginRoomConvolution::run()
+{
+	juce::ScopedNoDenormals noDenormals;
+
+	while (!threadShouldExit())
+	{
+		bool isConvolving = true;
+
+		// A chunk at a time, so the audio thread never waits for more than one.
+		while (isConvolving && !threadShouldExit())
+		{
+			const juce::SpinLock::ScopedLockType lock(mTailLock);
+			isConvolving = convolveTailChunk();
+		}
+
+		wait(sleepMilliseconds);
+	}
+}
+
+bool PluginRoomConvolution::convolveTailChunk()
+{
+	const int numberOfFrames = juce::jmin(mInputFifo.getNumReady(), mOutputFifo.getFreeSpace(), mMaximumBlockSize);
+
+	if (numberOfFrames <= 0)
+	{
+		return false;
+	}
+
+	int start1, size1, start2, size2;
+	mInputFifo.prepareToRead(numberOfFrames, start1, size1, start2, size2);
+
+	for (int channel = 0; channel < 2; channel++)
+	{
+		mTailFrames.copyFrom(channel, 0, mInputFrames, channel, start1, size1);
+		mTailFrames.copyFrom(channel, size1, mInputFrames, channel, start2, size2);
+	}
+
+	mInputFifo.finishedRead(size1 + size2);
+
+	auto tailBlock = juce::dsp::AudioBlock<float>(mTailFrames).getSubBlock(0, (size_t)numberOfFrames);
+	mTailConvolution.process(juce::dsp::ProcessContextReplacing<float>(tailBlock));
+
+	copyToFifo(tailBlock, mOutputFifo, mOutputFrames, numberOfFrames);
+
+	return true;
+}
+
+void PluginRoomConvolution::convolvePendingTail()
+{
+	// Waits for the chunk the background thread may be on, then takes over the rest.
+	bool isConvolving = true;
+
+	while (isConvolving)
+	{
+		const juce::SpinLock::ScopedLockType lock(mTailLock);
+		isConvolving = convolveTailChunk();
+	}
+}
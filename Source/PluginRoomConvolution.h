@@ -0,0 +1,51 @@
+#pragma once
+#include <JuceHeader.h>
+#include <memory>
+#include "Configuration/Samples.h"
+#include "Synthesiser/PluginSampleData.h"
+
+/*
+	Zero latency stereo convolution with a long room impulse response. Only the head of the
+	response, Samples::roomConvolutionHeadBlocks host blocks long, is convolved on the audio
+	thread. The tail needs nothing newer than a head length ago, so a background thread
+	convolves it ahead of time into a fifo the audio thread mixes from, a head length later.
+	Should the thread fall behind, the audio thread convolves what is still pending itself:
+	the tail is never dropped.
+*/
+class PluginRoomConvolution : private juce::Thread
+{
+public:
+	explicit PluginRoomConvolution(juce::AudioFormatReader& impulseResponseReader);
+	~PluginRoomConvolution() override;
+
+	void prepare(const juce::dsp::ProcessSpec& spec); // message thread, not while processing
+	void reset(); // not while processing
+	void process(const juce::dsp::ProcessContextReplacing<float>& context); // stereo
+
+	// Whether both convolutions have swapped in their response, which happens in process()
+	// once the loading threads are done.
+	bool isReady() const noexcept;
+
+private:
+	static constexpr int sleepMilliseconds = 100;
+
+	std::unique_ptr<PluginSampleData> mImpulseResponse; // as read, with a copy per host rate
+	juce::dsp::Convolution mHeadConvolution { juce::dsp::Convolution::NonUniform{ Samples::roomConvolutionHeadSize } };
+	juce::dsp::Convolution mTailConvolution;
+	int mHeadLength = 0; // in host frames, also the delay of the tail
+	int mTailLength = 0; // 0 when the whole response fits in the head
+	int mMaximumBlockSize = 0;
+
+	// Input frames waiting for the tail, and tail frames waiting to be mixed. Whoever holds
+	// mTailLock reads the first and writes the second.
+	juce::AbstractFifo mInputFifo { 1 };
+	juce::AbstractFifo mOutputFifo { 1 };
+	juce::AudioBuffer<float> mInputFrames;
+	juce::AudioBuffer<float> mOutputFrames;
+	juce::AudioBuffer<float> mTailFrames;
+	juce::SpinLock mTailLock;
+
+	void run() override;
+	bool convolveTailChunk(); // false when no input is pending, mTailLock held
+	void convolvePendingTail(); // audio thread, when the background thread has fallen behind
+};
@@ -0,0 +1,147 @@
+#include "PluginCompressedChannel.h"
+
+namespace
+{
+    constexpr float int24Scale = 8388608.0f;
+    
+    int quantise(float value)
+    {
+        return juce::jlimit(-8388608, 8388607, juce::roundToInt(value * int24Scale));
+    }
+}
+
+PluginCompressedChannel::PluginCompressedChannel(const float* source, const int numberOfFrames) :
+mNumberOfFrames(numberOfFrames)
+{
+    int frames[blockLength];
+    juce::uint32 residuals[blockLength];
+    
+    for (int blockStart = 0; blockStart < numberOfFrames; blockStart += blockLength)
+    {
+        const int blockFrames = juce::jmin(blockLength, numberOfFrames - blockStart);
+        juce::uint32 maxResidual = 0;
+        
+        for (int frame = 0; frame < blockFrames; frame++)
+        {
+            frames[frame] = quantise(source[blockStart + frame]);
+        }
+        
+        for (int frame = 2; frame < blockFrames; frame++)
+        {
+            const int residual = frames[frame] - 2 * frames[frame - 1] + frames[frame - 2];
+            residuals[frame] = ((juce::uint32)residual << 1) ^ (juce::uint32)(residual >> 31);
+            maxResidual |= residuals[frame];
+        }
+        
+        int width = 0;
+        
+        while (width < 32 && (maxResidual >> width) != 0)
+        {
+            width++;
+        }
+        
+        mBlockOffsets.push_back((juce::uint32)mWords.size());
+        mWords.push_back((juce::uint32)width);
+        mWords.push_back((juce::uint32)frames[0]);
+        mWords.push_back(blockFrames > 1 ? (juce::uint32)frames[1] : 0);
+        
+        juce::uint64 bits = 0;
+        int numberOfBits = 0;
+        
+        for (int frame = 2; frame < blockFrames; frame++)
+        {
+            bits |= (juce::uint64)residuals[frame] << numberOfBits;
+            numberOfBits += width;
+            
+            if (numberOfBits >= 32)
+            {
+                mWords.push_back((juce::uint32)bits);
+                bits >>= 32;
+                numberOfBits -= 32;
+            }
+        }
+        
+        if (numberOfBits > 0)
+        {
+            mWords.push_back((juce::uint32)bits);
+        }
+    }
+    
+    mWords.push_back(0);
+    mWords.shrink_to_fit();
+    mBlockOffsets.shrink_to_fit();
+}
+
+size_t PluginCompressedChannel::getMemorySize() const
+{
+    return (mWords.size() + mBlockOffsets.size()) * sizeof(juce::uint32);
+}
+
+void PluginCompressedChannel::decodeBlock(const int blockIndex, int* destination) const
+{
+    const juce::uint32* words = mWords.data() + mBlockOffsets[(size_t)blockIndex];
+    const int blockFrames = juce::jmin(blockLength, mNumberOfFrames - blockIndex * blockLength);
+    const int width = (int)words[0];
+    const juce::uint64 mask = (((juce::uint64)1) << width) - 1;
+    
+    destination[0] = (int)words[1];
+    destination[1] = blockFrames > 1 ? (int)words[2] : 0;
+    words += 3;
+    
+    // Each residual is found from its own bit position, no running bit buffer, so the unpack
+    // and zigzag loop has no carried state or branches and vectorises.
+    juce::uint32 zigzags[blockLength];
+    int* residuals = destination + 2;
+    const int numberOfResiduals = blockFrames - 2;
+    
+    for (int residualIndex = 0; residualIndex < numberOfResiduals; residualIndex++)
+    {
+        const juce::uint32 bitPosition = (juce::uint32)(residualIndex * width);
+        const juce::uint32 wordIndex = bitPosition >> 5;
+        const juce::uint64 pair = (juce::uint64)words[wordIndex] | ((juce::uint64)words[wordIndex + 1] << 32);
+        zigzags[residualIndex] = (juce::uint32)((pair >> (bitPosition & 31)) & mask);
+    }
+    
+    for (int residualIndex = 0; residualIndex < numberOfResiduals; residualIndex++)
+    {
+        residuals[residualIndex] = (int)(zigzags[residualIndex] >> 1) ^ -(int)(zigzags[residualIndex] & 1);
+    }
+    
+    // Undo the predictor as two running sums: slope, then value.
+    int slope = destination[1] - destination[0];
+    
+    for (int frame = 2; frame < blockFrames; frame++)
+    {
+        slope += destination[frame];
+        destination[frame] = destination[frame - 1] + slope;
+    }
+}
+
+void PluginCompressedChannel::readFrames(int startFrame, int numberOfFrames, float* destination, Cursor& cursor) const
+{
+    while (numberOfFrames > 0)
+    {
+        const int blockIndex = startFrame / blockLength;
+        const int offset = startFrame - blockIndex * blockLength;
+        const int numberOfBlockFrames = juce::jmin(numberOfFrames, blockLength - offset);
+        
+        if (cursor.channel != this || cursor.blockIndex != blockIndex)
+        {
+            decodeBlock(blockIndex, cursor.frames);
+            cursor.channel = this;
+            cursor.blockIndex = blockIndex;
+        }
+        
+        juce::FloatVectorOperations::convertFixedToFloat(destination, cursor.frames + offset, 1.0f / int24Scale, numberOfBlockFrames);
+        
+        startFrame += numberOfBlockFrames;
+        destination += numberOfBlockFrames;
+        numberOfFrames -= numberOfBlockFrames;
+    }
+}
+
+void PluginCompressedChannel::readFrames(const int startFrame, const int numberOfFrames, float* destination) const
+{
+    Cursor cursor;
+    readFrames(startFrame, numberOfFrames, destination, cursor);
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <JuceHeader.h>
+#include <vector>
+
+/*
+    Lossless compressed copy of one channel of 24-bit audio, for samples that should stay
+    fully resident in less memory.
+
+    Frames are split into blocks of blockLength that decode independently. Each block is
+    a width word, two warm-up samples, then the zigzagged residuals of a fixed second
+    order predictor (x[n] - 2x[n-1] + x[n-2]) packed LSB first at width bits each.
+    One spare word follows the last block so residuals can always be read as a pair of words.
+*/
+class PluginCompressedChannel
+{
+public:
+    static constexpr int blockLength = 256;
+    
+    // The last block decoded for a reader, so a voice reading unaligned chunks decodes each
+    // block once rather than once per chunk that touches it.
+    struct Cursor {
+        const PluginCompressedChannel* channel = nullptr;
+        int blockIndex = -1;
+        int frames[blockLength];
+    };
+    
+    PluginCompressedChannel(const float* source, int numberOfFrames);
+    
+    size_t getMemorySize() const;
+    void readFrames(int startFrame, int numberOfFrames, float* destination, Cursor& cursor) const;
+    void readFrames(int startFrame, int numberOfFrames, float* destination) const;
+    
+private:
+    void decodeBlock(int blockIndex, int* destination) const;
+    
+    std::vector<juce::uint32> mWords;
+    std::vector<juce::uint32> mBlockOffsets; // index into mWords of each block
+    int mNumberOfFrames;
+};
@@ -0,0 +1,168 @@
+#include "PluginKitFile.h"
+
+namespace
+{
+    const char magic[4] = { 'P', 'P', 'D', 'K' };
+
+    juce::uint64 alignOffset(juce::uint64 offset)
+    {
+        return (offset + PluginKitFile::alignment - 1) / PluginKitFile::alignment * PluginKitFile::alignment;
+    }
+
+    void writePadding(juce::OutputStream& stream, juce::int64 numberOfBytes)
+    {
+        for (juce::int64 byteIndex = 0; byteIndex < numberOfBytes; byteIndex++)
+        {
+            stream.writeByte(0);
+        }
+    }
+}
+
+PluginKitFile::PluginKitFile(const juce::File& file)
+{
+    mMappedFile = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+
+    const auto* data = static_cast<const char*>(mMappedFile->getData());
+    const auto size = (juce::uint64)mMappedFile->getSize();
+
+    if (data == nullptr || size < headerSize || std::memcmp(data, magic, sizeof(magic)) != 0)
+    {
+        DBG("not a kit file " + file.getFullPathName());
+        return;
+    }
+
+    if ((int)juce::ByteOrder::littleEndianInt(data + 4) != version)
+    {
+        DBG("unsupported kit file version " + file.getFullPathName());
+        return;
+    }
+
+    const auto numberOfEntries = juce::ByteOrder::littleEndianInt(data + 8);
+
+    if (size < headerSize + (juce::uint64)numberOfEntries * entrySize)
+    {
+        DBG("truncated kit file " + file.getFullPathName());
+        return;
+    }
+
+    for (juce::uint32 entryIndex = 0; entryIndex < numberOfEntries; entryIndex++)
+    {
+        const auto* entryData = data + headerSize + entryIndex * entrySize;
+
+        Entry entry;
+        entry.midiNote = (juce::uint8)entryData[0];
+        entry.velocityIndex = (juce::uint8)entryData[1];
+        entry.variationIndex = (juce::uint8)entryData[2];
+        entry.numberOfChannels = (juce::uint8)entryData[3];
+        const auto numberOfFrames = juce::ByteOrder::littleEndianInt(entryData + 4);
+        entry.numberOfFrames = (int)juce::jmin(numberOfFrames, (juce::uint32)maximumFrames + 1);
+
+        const auto sampleRateBits = juce::ByteOrder::littleEndianInt64(entryData + 8);
+        std::memcpy(&entry.sampleRate, &sampleRateBits, sizeof(double));
+
+        entry.dataOffset = juce::ByteOrder::littleEndianInt64(entryData + 16);
+        entry.micId = std::string(entryData + 24, strnlen(entryData + 24, micIdSize));
+
+        // Everything below is used as a length or a divisor, so it is checked before anything is sized from it.
+        if (entry.numberOfFrames <= 0 || entry.numberOfFrames > maximumFrames
+            || !std::isfinite(entry.sampleRate) || entry.sampleRate <= 0.0
+            || entry.midiNote > 127)
+        {
+            DBG("invalid kit file entry " + juce::String((int)entryIndex));
+            mEntries.clear();
+            return;
+        }
+
+        const auto dataSize = (juce::uint64)entry.numberOfChannels * getPaddedFrameCount(entry.numberOfFrames) * sizeof(float);
+
+        if (entry.numberOfChannels < 1 || entry.numberOfChannels > 2
+            || entry.dataOffset % alignment != 0
+            || entry.dataOffset > size
+            || dataSize > size - entry.dataOffset)
+        {
+            DBG("invalid kit file entry " + juce::String((int)entryIndex));
+            mEntries.clear();
+            return;
+        }
+
+        mEntries.push_back(entry);
+    }
+
+    mIsValid = true;
+}
+
+const float* PluginKitFile::getChannelData(const Entry& entry, const int channel) const
+{
+    const auto* data = static_cast<const char*>(mMappedFile->getData());
+    const auto channelOffset = (juce::uint64)channel * getPaddedFrameCount(entry.numberOfFrames) * sizeof(float);
+
+    return reinterpret_cast<const float*>(data + entry.dataOffset + channelOffset);
+}
+
+int PluginKitFile::getPaddedFrameCount(const int numberOfFrames)
+{
+    constexpr int framesPerAlignment = alignment / (int)sizeof(float);
+    return (numberOfFrames + guardFrames + framesPerAlignment - 1) / framesPerAlignment * framesPerAlignment;
+}
+
+bool PluginKitFile::write(const juce::File& file, const std::vector<std::pair<Entry, const juce::AudioBuffer<float>*>>& samples)
+{
+    file.deleteFile();
+    juce::FileOutputStream stream(file);
+
+    if (stream.failedToOpen())
+    {
+        DBG("could not create kit file " + file.getFullPathName());
+        return false;
+    }
+
+    stream.write(magic, sizeof(magic));
+    stream.writeInt(version);
+    stream.writeInt((int)samples.size());
+    stream.writeInt(0);
+
+    juce::uint64 dataOffset = alignOffset(headerSize + (juce::uint64)samples.size() * entrySize);
+
+    for (const auto& sample : samples)
+    {
+        const auto& entry = sample.first;
+        const int numberOfChannels = juce::jmin(2, sample.second->getNumChannels());
+
+        char micId[micIdSize] = {};
+        std::memcpy(micId, entry.micId.data(), juce::jmin((size_t)micIdSize - 1, entry.micId.size()));
+
+        stream.writeByte((char)entry.midiNote);
+        stream.writeByte((char)entry.velocityIndex);
+        stream.writeByte((char)entry.variationIndex);
+        stream.writeByte((char)numberOfChannels);
+        stream.writeInt(entry.numberOfFrames);
+        stream.writeDouble(entry.sampleRate);
+        stream.writeInt64((juce::int64)dataOffset);
+        stream.write(micId, micIdSize);
+
+        dataOffset += (juce::uint64)numberOfChannels * getPaddedFrameCount(entry.numberOfFrames) * sizeof(float);
+    }
+
+    writePadding(stream, (juce::int64)alignOffset((juce::uint64)stream.getPosition()) - stream.getPosition());
+
+    for (const auto& sample : samples)
+    {
+        const auto& entry = sample.first;
+        const auto& buffer = *sample.second;
+        const int numberOfChannels = juce::jmin(2, buffer.getNumChannels());
+        const int paddedFrameCount = getPaddedFrameCount(entry.numberOfFrames);
+
+        for (int channel = 0; channel < numberOfChannels; channel++)
+        {
+            const float* channelData = buffer.getReadPointer(channel);
+
+            for (int frame = 0; frame < paddedFrameCount; frame++)
+            {
+                stream.writeFloat(frame < entry.numberOfFrames && frame < buffer.getNumSamples() ? channelData[frame] : 0.0f);
+            }
+        }
+    }
+
+    stream.flush();
+    return stream.getStatus().wasOk();
+}
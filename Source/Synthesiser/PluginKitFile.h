@@ -0,0 +1,67 @@
+#pragma once
+#include <JuceHeader.h>
+#include <string>
+#include <vector>
+
+/*
+    Kit container, memory mapped read-only so processes sharing a kit share its pages.
+    All values are little-endian.
+
+    offset  size    field
+    0       4       magic "PPDK"
+    4       4       version
+    8       4       number of entries
+    12      4       reserved, 0
+    16      48 * n  entries:
+                    1   midi note
+                    1   velocity index
+                    1   variation index
+                    1   number of channels, 1 or 2
+                    4   number of frames
+                    8   sample rate, double
+                    8   offset of the sample data from the start of the file
+                    24  mic id, nul padded ("" for single mic samples)
+
+    Sample data is planar 32-bit float. Each channel holds the frames followed by
+    guardFrames of silence (the voice interpolates one frame ahead), is padded to a
+    multiple of alignment bytes and starts on an alignment boundary, so the mapped
+    frames are used in place.
+*/
+class PluginKitFile
+{
+public:
+    struct Entry {
+        int midiNote = -1;
+        int velocityIndex = 0;
+        int variationIndex = 0;
+        int numberOfChannels = 0;
+        int numberOfFrames = 0;
+        double sampleRate = 0.0;
+        juce::uint64 dataOffset = 0;
+        std::string micId;
+    };
+
+    static constexpr int version = 1;
+    static constexpr int alignment = 32;
+    static constexpr int guardFrames = 4;
+    static constexpr int headerSize = 16;
+    static constexpr int entrySize = 48;
+    static constexpr int micIdSize = 24;
+    static constexpr int maximumFrames = 1 << 27; // about 50 minutes at 44.1 kHz, keeps padded sizes well inside int
+
+    explicit PluginKitFile(const juce::File& file);
+
+    bool isValid() const noexcept { return mIsValid; }
+    const std::vector<Entry>& getEntries() const noexcept { return mEntries; }
+    const float* getChannelData(const Entry& entry, int channel) const;
+
+    static int getPaddedFrameCount(int numberOfFrames);
+    static bool write(const juce::File& file, const std::vector<std::pair<Entry, const juce::AudioBuffer<float>*>>& samples);
+
+private:
+    std::unique_ptr<juce::MemoryMappedFile> mMappedFile;
+    std::vector<Entry> mEntries;
+    bool mIsValid = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginKitFile)
+};
@@ -0,0 +1,293 @@
+#include "PluginSampleData.h"
+
+namespace
+{
+    // Kaiser windowed sinc for the offline resampler, about 80 dB of image and alias rejection.
+    constexpr int sincZeroCrossings = 32; // each side, at the cutoff
+    constexpr int sincPhases = 512; // table entries per zero crossing, linearly interpolated
+    constexpr double sincKaiserBeta = 8.0;
+    constexpr double sincCutoff = 0.91; // of the lower Nyquist frequency, leaves room for the transition band
+    
+    // One side of the kernel, from the centre to the last zero crossing.
+    const std::vector<float>& getSincTable()
+    {
+        static const std::vector<float> table = []()
+        {
+            std::vector<float> entries((size_t)(sincZeroCrossings * sincPhases + 2), 0.0f);
+            const double windowScale = 1.0 / juce::dsp::SpecialFunctions::besselI0(sincKaiserBeta);
+            
+            for (int entry = 0; entry <= sincZeroCrossings * sincPhases; entry++)
+            {
+                const double x = (double)entry / sincPhases;
+                const double sinc = entry == 0 ? 1.0 : std::sin(juce::MathConstants<double>::pi * x) / (juce::MathConstants<double>::pi * x);
+                const double window = juce::dsp::SpecialFunctions::besselI0(sincKaiserBeta * std::sqrt(juce::jmax(0.0, 1.0 - juce::square(x / sincZeroCrossings)))) * windowScale;
+                entries[(size_t)entry] = (float)(sinc * window);
+            }
+            
+            return entries;
+        }();
+        
+        return table;
+    }
+}
+
+PluginSampleData::PluginSampleData(juce::AudioFormatReader& source,
+                                   double maxSampleLengthSeconds,
+                                   int preloadLengthInSamples,
+                                   PluginSampleStorage::Format storageFormat,
+                                   juce::int64 startFrame,
+                                   float tailFloorGain,
+                                   int tailFadeLength) :
+mSourceSampleRate(source.sampleRate)
+{
+    startFrame = juce::jlimit((juce::int64)0, juce::jmax((juce::int64)0, source.lengthInSamples - 1), startFrame);
+    
+    if (mSourceSampleRate > 0 && source.lengthInSamples > 0)
+    {
+        mLength = juce::jmin((int)(source.lengthInSamples - startFrame), (int)(maxSampleLengthSeconds * mSourceSampleRate));
+        mPreloadLength = preloadLengthInSamples < 0 ? mLength : juce::jmin(mLength, preloadLengthInSamples);
+        mTrimmedLeadingFrames = startFrame;
+        
+        mNumChannels = juce::jmin(2, (int)source.numChannels);
+        mData.reset(new juce::AudioBuffer<float>(mNumChannels, mPreloadLength + 4));
+        
+        source.read(mData.get(), 0, mPreloadLength + 4, startFrame, true, true);
+        
+        // The tail of a streamed sample is never in memory, so only resident ones are cut.
+        if (tailFloorGain > 0.0f && mPreloadLength == mLength)
+        {
+            truncateTail(tailFloorGain, tailFadeLength);
+        }
+        
+        if (mPreloadLength == mLength)
+        {
+            computeRemainingPeaks();
+        }
+        
+        if (storageFormat == PluginSampleStorage::Format::lossless)
+        {
+            for (int channel = 0; channel < mNumChannels; channel++)
+            {
+                mCompressedChannels.emplace_back(mData->getReadPointer(channel), mPreloadLength + 4);
+            }
+            
+            mStorageFormat = storageFormat;
+            mData.reset();
+        }
+        else if (storageFormat != PluginSampleStorage::Format::float32)
+        {
+            const int bytesPerChannel = (mPreloadLength + 4) * PluginSampleStorage::bytesPerSample(storageFormat);
+            mPackedData.malloc((size_t)(mNumChannels * bytesPerChannel));
+            
+            for (int channel = 0; channel < mNumChannels; channel++)
+            {
+                PluginSampleStorage::encode(storageFormat, mData->getReadPointer(channel), mPackedData + channel * bytesPerChannel, mPreloadLength + 4);
+            }
+            
+            mStorageFormat = storageFormat;
+            mData.reset();
+        }
+    }
+}
+
+PluginSampleData::PluginSampleData(const PluginKitFile& kitFile, const PluginKitFile::Entry& kitFileEntry) :
+mSourceSampleRate(kitFileEntry.sampleRate)
+{
+    mLength = kitFileEntry.numberOfFrames;
+    mPreloadLength = mLength;
+    mNumChannels = kitFileEntry.numberOfChannels;
+    
+    // The guard frames stand in for the + 4 above.
+    float* channels[2];
+    
+    for (int channel = 0; channel < kitFileEntry.numberOfChannels; channel++)
+    {
+        channels[channel] = const_cast<float*>(kitFile.getChannelData(kitFileEntry, channel));
+    }
+    
+    mData.reset(new juce::AudioBuffer<float>(channels, kitFileEntry.numberOfChannels, mLength + PluginKitFile::guardFrames));
+}
+
+void PluginSampleData::truncateTail(const float floorGain, const int fadeLength)
+{
+    int lastAudibleFrame = mLength - 1;
+    
+    while (lastAudibleFrame > 0 && mData->getMagnitude(lastAudibleFrame, 1) < floorGain)
+    {
+        lastAudibleFrame--;
+    }
+    
+    const int length = juce::jmin(mLength, lastAudibleFrame + 1 + fadeLength);
+    
+    if (length >= mLength)
+    {
+        return;
+    }
+    
+    const int fadeStart = juce::jmax(0, length - fadeLength);
+    mData->applyGainRamp(fadeStart, length - fadeStart, 1.0f, 0.0f);
+    
+    mData->setSize(mNumChannels, length + 4, true, false, false);
+    mData->clear(length, 4);
+    
+    mTrimmedTailFrames = mLength - length;
+    mLength = length;
+    mPreloadLength = length;
+}
+
+void PluginSampleData::computeRemainingPeaks()
+{
+    const int numberOfBlocks = (mLength + envelopeBlockLength - 1) / envelopeBlockLength;
+    mRemainingPeaks.resize((size_t)numberOfBlocks);
+    
+    float remainingPeak = 0.0f;
+    
+    for (int blockIndex = numberOfBlocks; blockIndex-- > 0;)
+    {
+        const int blockStart = blockIndex * envelopeBlockLength;
+        remainingPeak = juce::jmax(remainingPeak, mData->getMagnitude(blockStart, juce::jmin(envelopeBlockLength, mLength - blockStart)));
+        mRemainingPeaks[(size_t)blockIndex] = remainingPeak;
+    }
+}
+
+// Band-limited to just below the lower of the two Nyquist frequencies, so upsampling leaves
+// no images and downsampling folds nothing back. Built once per rate, off the audio thread.
+PluginSampleData::PluginSampleData(const PluginSampleData& source, double sampleRate) :
+mSourceSampleRate(sampleRate)
+{
+    jassert(source.mData != nullptr);
+    
+    const double speedRatio = source.mSourceSampleRate / sampleRate;
+    
+    mLength = (int)std::ceil(source.mLength / speedRatio);
+    mPreloadLength = mLength;
+    mNumChannels = source.mNumChannels;
+    
+    mData.reset(new juce::AudioBuffer<float>(mNumChannels, mLength + 4));
+    mData->clear();
+    
+    const auto& sincTable = getSincTable();
+    const double cutoff = sincCutoff * juce::jmin(1.0, 1.0 / speedRatio); // of the source Nyquist frequency
+    const double halfWidth = sincZeroCrossings / cutoff; // in source frames
+    const int sourceLength = source.mLength + 4; // frames outside are silence
+    
+    std::vector<float> weights((size_t)(2.0 * halfWidth) + 2);
+    
+    for (int frame = 0; frame < mLength; frame++)
+    {
+        const double position = frame * speedRatio;
+        const int firstFrame = juce::jmax(0, (int)std::ceil(position - halfWidth));
+        const int lastFrame = juce::jmin(sourceLength - 1, (int)std::floor(position + halfWidth));
+        const int numberOfTaps = lastFrame - firstFrame + 1;
+        
+        for (int tap = 0; tap < numberOfTaps; tap++)
+        {
+            const double tablePosition = std::abs(position - (firstFrame + tap)) * cutoff * sincPhases;
+            const int entry = juce::jmin((int)tablePosition, sincZeroCrossings * sincPhases);
+            const float alpha = (float)(tablePosition - entry);
+            weights[(size_t)tap] = (float)cutoff * (sincTable[(size_t)entry] + alpha * (sincTable[(size_t)entry + 1] - sincTable[(size_t)entry]));
+        }
+        
+        for (int channel = 0; channel < mNumChannels; channel++)
+        {
+            const float* sourceFrames = source.mData->getReadPointer(channel, firstFrame);
+            float sum = 0.0f;
+            
+            for (int tap = 0; tap < numberOfTaps; tap++)
+            {
+                sum += sourceFrames[tap] * weights[(size_t)tap];
+            }
+            
+            mData->setSample(channel, frame, sum);
+        }
+    }
+    
+    computeRemainingPeaks();
+}
+
+const PluginSampleData* PluginSampleData::getResampled(const double sampleRate) const
+{
+    if (mData == nullptr || mPreloadLength < mLength)
+    {
+        return nullptr;
+    }
+    
+    if (sampleRate == mSourceSampleRate)
+    {
+        return this;
+    }
+    
+    const juce::ScopedLock sl(mResampledLock);
+    auto& resampled = mResampled[juce::roundToInt(sampleRate)];
+    
+    if (resampled == nullptr)
+    {
+        resampled.reset(new PluginSampleData(*this, sampleRate));
+    }
+    
+    return resampled.get();
+}
+
+size_t PluginSampleData::getResampledMemorySize() const
+{
+    const juce::ScopedLock sl(mResampledLock);
+    size_t memorySize = 0;
+    
+    for (const auto& sampleRateAndData : mResampled)
+    {
+        memorySize += sampleRateAndData.second->getMemorySize();
+    }
+    
+    return memorySize;
+}
+
+size_t PluginSampleData::getMemorySize() const
+{
+    if (!mCompressedChannels.empty())
+    {
+        size_t memorySize = 0;
+        
+        for (const auto& compressedChannel : mCompressedChannels)
+        {
+            memorySize += compressedChannel.getMemorySize();
+        }
+        
+        return memorySize;
+    }
+    
+    const auto bytesPerSample = mData != nullptr ? sizeof(float) : (size_t)PluginSampleStorage::bytesPerSample(mStorageFormat);
+    return (size_t)mNumChannels * (size_t)(mPreloadLength + 4) * bytesPerSample;
+}
+
+size_t PluginSampleData::getUncompressedMemorySize() const
+{
+    return (size_t)mNumChannels * (size_t)(mPreloadLength + 4) * sizeof(float);
+}
+
+void PluginSampleData::readFrames(const int channel, const int startFrame, const int numberOfFrames, float* destination, PluginCompressedChannel::Cursor* cursor) const
+{
+    if (mData != nullptr)
+    {
+        std::memcpy(destination, mData->getReadPointer(channel, startFrame), (size_t)numberOfFrames * sizeof(float));
+        return;
+    }
+    
+    if (!mCompressedChannels.empty())
+    {
+        if (cursor != nullptr)
+        {
+            mCompressedChannels[(size_t)channel].readFrames(startFrame, numberOfFrames, destination, *cursor);
+        }
+        else
+        {
+            mCompressedChannels[(size_t)channel].readFrames(startFrame, numberOfFrames, destination);
+        }
+        
+        return;
+    }
+    
+    const int bytesPerSample = PluginSampleStorage::bytesPerSample(mStorageFormat);
+    const char* channelData = mPackedData + channel * (mPreloadLength + 4) * bytesPerSample;
+    
+    PluginSampleStorage::decode(mStorageFormat, channelData + startFrame * bytesPerSample, destination, numberOfFrames);
+}
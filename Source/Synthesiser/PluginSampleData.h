@@ -0,0 +1,71 @@
+#pragma once
+#include <JuceHeader.h>
+#include <map>
+#include "PluginKitFile.h"
+#include "PluginSampleStorage.h"
+#include "PluginCompressedChannel.h"
+
+/*
+    Decoded frames of one sample. Immutable once built, so a single copy can back the
+    sounds of every plugin instance (see PluginSamplePool).
+*/
+class PluginSampleData
+{
+public:
+    // Reads from startFrame on. With a tailFloorGain above 0 the tail of a fully loaded
+    // sample is truncated once it stays below it and faded out over tailFadeLength frames.
+    PluginSampleData(juce::AudioFormatReader& source,
+                     double maxSampleLengthSeconds,
+                     int preloadLengthInSamples = -1,
+                     PluginSampleStorage::Format storageFormat = PluginSampleStorage::Format::float32,
+                     juce::int64 startFrame = 0,
+                     float tailFloorGain = 0.0f,
+                     int tailFadeLength = 0);
+    
+    // Refers straight into the mapped kit file, which must outlive this.
+    PluginSampleData(const PluginKitFile& kitFile, const PluginKitFile::Entry& kitFileEntry);
+    
+    // Copy at sampleRate, built on first request and kept for the lifetime of this object
+    // (one per rate). Returns this when the rates already match. Only resident float
+    // samples are resampled, packed and streamed ones return nullptr so they keep their
+    // smaller footprint.
+    const PluginSampleData* getResampled(double sampleRate) const;
+    
+    size_t getMemorySize() const;
+    size_t getResampledMemorySize() const;
+    size_t getUncompressedMemorySize() const; // as resident float
+    void readFrames(int channel, int startFrame, int numberOfFrames, float* destination, PluginCompressedChannel::Cursor* cursor = nullptr) const;
+    
+    // Peak magnitude from frame to the end of the sample, at envelopeBlockLength resolution.
+    // 1 when unknown: streamed tails are never in memory and mapped kit data is not scanned.
+    float getRemainingPeak(int frame) const noexcept
+    {
+        const int blockIndex = frame / envelopeBlockLength;
+        return mRemainingPeaks.empty() ? 1.0f : blockIndex < (int)mRemainingPeaks.size() ? mRemainingPeaks[(size_t)blockIndex] : 0.0f;
+    }
+    
+    static constexpr int envelopeBlockLength = 256;
+    
+    double mSourceSampleRate = 0.0;
+    int mLength = 0;
+    int mPreloadLength = 0; // frames held in memory, equal to mLength unless streaming
+    int mNumChannels = 0;
+    juce::int64 mTrimmedLeadingFrames = 0;
+    int mTrimmedTailFrames = 0;
+    std::unique_ptr<juce::AudioBuffer<float>> mData; // null when packed
+    PluginSampleStorage::Format mStorageFormat = PluginSampleStorage::Format::float32;
+    juce::HeapBlock<char> mPackedData; // planar, mPreloadLength + 4 frames per channel
+    std::vector<PluginCompressedChannel> mCompressedChannels; // lossless only
+    std::vector<float> mRemainingPeaks; // one per envelope block, see getRemainingPeak()
+    
+private:
+    PluginSampleData(const PluginSampleData& source, double sampleRate);
+    
+    void truncateTail(float floorGain, int fadeLength);
+    void computeRemainingPeaks();
+    
+    mutable juce::CriticalSection mResampledLock;
+    mutable std::map<int, std::unique_ptr<const PluginSampleData>> mResampled;
+    
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginSampleData)
+};
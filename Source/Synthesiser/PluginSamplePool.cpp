@@ -0,0 +1,62 @@
+#include "PluginSamplePool.h"
+
+std::string PluginSamplePool::makeKey(const std::string& resourceName,
+                                      const PluginSampleStorage::Format storageFormat,
+                                      const int preloadLengthInSamples,
+                                      const juce::int64 startFrame,
+                                      const float tailFloorGain)
+{
+    return resourceName + "/" + std::to_string((int)storageFormat) + "/" + std::to_string(preloadLengthInSamples)
+        + "/" + std::to_string(startFrame) + "/" + std::to_string(tailFloorGain);
+}
+
+PluginSamplePool::SampleDataPtr PluginSamplePool::getOrLoad(const std::string& key, const std::function<std::unique_ptr<PluginSampleData>()>& load)
+{
+    {
+        const juce::ScopedLock sl(mLock);
+        auto it = mSamples.find(key);
+        
+        if (it != mSamples.end())
+        {
+            return it->second;
+        }
+    }
+    
+    SampleDataPtr sampleData(load());
+    
+    const juce::ScopedLock sl(mLock);
+    return mSamples.emplace(key, std::move(sampleData)).first->second;
+}
+
+juce::int64 PluginSamplePool::getOrFindStart(const std::string& resourceName, const float thresholdGain, const std::function<juce::int64()>& find)
+{
+    const std::string key = resourceName + "/" + std::to_string(thresholdGain);
+    
+    {
+        const juce::ScopedLock sl(mLock);
+        auto it = mStartFrames.find(key);
+        
+        if (it != mStartFrames.end())
+        {
+            return it->second;
+        }
+    }
+    
+    const juce::int64 startFrame = find();
+    
+    const juce::ScopedLock sl(mLock);
+    return mStartFrames.emplace(key, startFrame).first->second;
+}
+
+size_t PluginSamplePool::getMemorySize()
+{
+    const juce::ScopedLock sl(mLock);
+    size_t memorySize = 0;
+    
+    for (const auto& keyAndSampleData : mSamples)
+    {
+        memorySize += keyAndSampleData.second->getMemorySize();
+    }
+    
+    return memorySize;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <JuceHeader.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include "PluginSampleData.h"
+
+/*
+    Decoded samples shared by every plugin instance in the process. Hold it through a
+    juce::SharedResourcePointer: the first instance creates the pool and fills it, later
+    instances attach to the same samples, and it is freed with the last instance.
+*/
+class PluginSamplePool
+{
+public:
+    using SampleDataPtr = std::shared_ptr<const PluginSampleData>;
+    
+    static std::string makeKey(const std::string& resourceName,
+                               PluginSampleStorage::Format storageFormat,
+                               int preloadLengthInSamples,
+                               juce::int64 startFrame,
+                               float tailFloorGain);
+    
+    // Returns the pooled sample for key, calling load to build it on a miss. Loading runs
+    // outside the lock; if two instances race on the same key the first one stored wins.
+    SampleDataPtr getOrLoad(const std::string& key, const std::function<std::unique_ptr<PluginSampleData>()>& load);
+    
+    // The first frame of a resource above thresholdGain, calling find on a miss. Finding it
+    // decodes the whole resource, so it is done once per process rather than per instance.
+    juce::int64 getOrFindStart(const std::string& resourceName, float thresholdGain, const std::function<juce::int64()>& find);
+    
+    size_t getMemorySize();
+    
+private:
+    juce::CriticalSection mLock;
+    std::map<std::string, SampleDataPtr> mSamples;
+    std::map<std::string, juce::int64> mStartFrames;
+};
@@ -0,0 +1,171 @@
+#pragma once
+#include <JuceHeader.h>
+#include <cstring>
+#include <string>
+
+namespace PluginSampleStorage
+{
+	enum class Format {
+		float32,
+		int24,
+		int16,
+		float16,
+		lossless // block compressed, see PluginCompressedChannel
+	};
+
+	static const std::string float32Id = "float32";
+	static const std::string int24Id = "int24";
+	static const std::string int16Id = "int16";
+	static const std::string float16Id = "float16";
+	static const std::string losslessId = "lossless";
+
+	static inline Format formatFromId(const std::string& formatId)
+	{
+		if (formatId == int24Id) return Format::int24;
+		if (formatId == int16Id) return Format::int16;
+		if (formatId == float16Id) return Format::float16;
+		if (formatId == losslessId) return Format::lossless;
+		return Format::float32;
+	}
+
+	static inline int bytesPerSample(const Format format)
+	{
+		switch (format)
+		{
+		case Format::int24: return 3;
+		case Format::int16: return 2;
+		case Format::float16: return 2;
+		default: return 4;
+		}
+	}
+
+	// IEEE half conversions after Fabian Giesen's float/half routines. floatToHalf only runs
+	// while loading; halfToFloat picks its infinity and denormal cases with masks instead of
+	// branches, so the decode loop below vectorises.
+	static inline juce::uint16 floatToHalf(float value)
+	{
+		juce::uint32 bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+
+		const juce::uint32 sign = bits & 0x80000000u;
+		bits ^= sign;
+
+		juce::uint32 half;
+
+		if (bits >= ((127 + 16) << 23))
+		{
+			half = bits > (255u << 23) ? 0x7e00 : 0x7c00;
+		}
+		else if (bits < (113 << 23))
+		{
+			const juce::uint32 denormalMagicBits = ((127 - 15) + (23 - 10) + 1) << 23;
+			float denormalMagic, magnitude;
+			std::memcpy(&denormalMagic, &denormalMagicBits, sizeof(float));
+			std::memcpy(&magnitude, &bits, sizeof(float));
+			magnitude += denormalMagic;
+			std::memcpy(&bits, &magnitude, sizeof(float));
+			half = bits - denormalMagicBits;
+		}
+		else
+		{
+			const juce::uint32 mantissaOdd = (bits >> 13) & 1;
+			bits += ((juce::uint32)(15 - 127) << 23) + 0xfff + mantissaOdd;
+			half = bits >> 13;
+		}
+
+		return (juce::uint16)(half | (sign >> 16));
+	}
+
+	static inline float halfToFloat(const juce::uint16 half)
+	{
+		const juce::uint32 shiftedExponent = 0x7c00u << 13;
+		const juce::uint32 denormalMagicBits = 113u << 23;
+
+		juce::uint32 bits = ((juce::uint32)half & 0x7fff) << 13;
+		const juce::uint32 exponent = shiftedExponent & bits;
+		const juce::uint32 infinityMask = 0u - (juce::uint32)(exponent == shiftedExponent);
+		const juce::uint32 denormalMask = 0u - (juce::uint32)(exponent == 0);
+		bits += ((127 - 15) << 23) + (infinityMask & ((128 - 16) << 23));
+
+		// Denormals are renormalised by the float unit, computed for every sample and selected.
+		float denormal, denormalMagic;
+		const juce::uint32 denormalBits = bits + (1u << 23);
+		std::memcpy(&denormal, &denormalBits, sizeof(float));
+		std::memcpy(&denormalMagic, &denormalMagicBits, sizeof(float));
+		denormal -= denormalMagic;
+
+		juce::uint32 renormalisedBits;
+		std::memcpy(&renormalisedBits, &denormal, sizeof(float));
+		bits = (bits & ~denormalMask) | (renormalisedBits & denormalMask);
+		bits |= ((juce::uint32)half & 0x8000) << 16;
+
+		float value;
+		std::memcpy(&value, &bits, sizeof(float));
+		return value;
+	}
+
+	static inline void encode(const Format format, const float* source, void* destination, const int numberOfSamples)
+	{
+		using Float32Pointer = juce::AudioData::Pointer<juce::AudioData::Float32, juce::AudioData::NativeEndian, juce::AudioData::NonInterleaved, juce::AudioData::Const>;
+
+		switch (format)
+		{
+		case Format::int24:
+			juce::AudioData::Pointer<juce::AudioData::Int24, juce::AudioData::LittleEndian, juce::AudioData::NonInterleaved, juce::AudioData::NonConst>(destination)
+				.convertSamples(Float32Pointer(source), numberOfSamples);
+			break;
+		case Format::int16:
+			juce::AudioData::Pointer<juce::AudioData::Int16, juce::AudioData::NativeEndian, juce::AudioData::NonInterleaved, juce::AudioData::NonConst>(destination)
+				.convertSamples(Float32Pointer(source), numberOfSamples);
+			break;
+		case Format::float16:
+		{
+			auto* halfDestination = static_cast<juce::uint16*>(destination);
+			for (int sampleIndex = 0; sampleIndex < numberOfSamples; sampleIndex++)
+			{
+				halfDestination[sampleIndex] = floatToHalf(source[sampleIndex]);
+			}
+			break;
+		}
+		default:
+			std::memcpy(destination, source, (size_t)numberOfSamples * sizeof(float));
+			break;
+		}
+	}
+
+	static inline void decode(const Format format, const void* source, float* destination, const int numberOfSamples)
+	{
+		using Float32Pointer = juce::AudioData::Pointer<juce::AudioData::Float32, juce::AudioData::NativeEndian, juce::AudioData::NonInterleaved, juce::AudioData::NonConst>;
+
+		switch (format)
+		{
+		case Format::int24:
+			Float32Pointer(destination).convertSamples(
+				juce::AudioData::Pointer<juce::AudioData::Int24, juce::AudioData::LittleEndian, juce::AudioData::NonInterleaved, juce::AudioData::Const>(source),
+				numberOfSamples);
+			break;
+		case Format::int16:
+		{
+			const auto* int16Source = static_cast<const juce::int16*>(source);
+			constexpr float scale = 1.0f / 32768.0f;
+			for (int sampleIndex = 0; sampleIndex < numberOfSamples; sampleIndex++)
+			{
+				destination[sampleIndex] = (float)int16Source[sampleIndex] * scale;
+			}
+			break;
+		}
+		case Format::float16:
+		{
+			const auto* halfSource = static_cast<const juce::uint16*>(source);
+			for (int sampleIndex = 0; sampleIndex < numberOfSamples; sampleIndex++)
+			{
+				destination[sampleIndex] = halfToFloat(halfSource[sampleIndex]);
+			}
+			break;
+		}
+		default:
+			std::memcpy(destination, source, (size_t)numberOfSamples * sizeof(float));
+			break;
+		}
+	}
+}
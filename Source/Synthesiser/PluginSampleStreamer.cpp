@@ -0,0 +1,106 @@
+#include "PluginSampleStreamer.h"
+#include "PluginSynthesiserVoice.h"
+#include "../Configuration/Samples.h"
+
+PluginSampleStreamer::PluginSampleStreamer(const int preloadMilliseconds, const int numberOfSlots) :
+    mThread("Sample Streamer"),
+    mPreloadMilliseconds(preloadMilliseconds)
+{
+    for (int slotIndex = 0; slotIndex < numberOfSlots; slotIndex++)
+    {
+        mSlots.push_back(std::make_unique<StreamSlot>());
+        mSlots.back()->buffer.setSize(2, getBufferLengthInSamples(Samples::bitRate));
+    }
+
+    mThread.addTimeSliceClient(this);
+    mThread.startThread(juce::Thread::Priority::high);
+}
+
+PluginSampleStreamer::~PluginSampleStreamer()
+{
+    stop();
+}
+
+void PluginSampleStreamer::stop()
+{
+    mThread.removeTimeSliceClient(this);
+    mThread.stopThread(1000);
+}
+
+void PluginSampleStreamer::addVoice(PluginSynthesiserVoice* voice)
+{
+    const juce::ScopedLock sl(mVoicesLock);
+    mVoices.addIfNotAlreadyThere(voice);
+}
+
+void PluginSampleStreamer::removeVoice(PluginSynthesiserVoice* voice)
+{
+    const juce::ScopedLock sl(mVoicesLock);
+    mVoices.removeFirstMatchingValue(voice);
+}
+
+PluginSampleStreamer::StreamSlot* PluginSampleStreamer::acquireSlot()
+{
+    for (auto& slot : mSlots)
+    {
+        bool isInUse = false;
+
+        if (slot->isInUse.compare_exchange_strong(isInUse, true, std::memory_order_acquire))
+        {
+            return slot.get();
+        }
+    }
+
+    return nullptr;
+}
+
+void PluginSampleStreamer::releaseSlot(StreamSlot* slot)
+{
+    // Only called once the voice holding it has been removed from the streamer.
+    slot->isInUse.store(false, std::memory_order_release);
+}
+
+int PluginSampleStreamer::getPreloadLengthInSamples(const double sourceSampleRate) const
+{
+    return (int)std::ceil(sourceSampleRate * mPreloadMilliseconds / 1000.0);
+}
+
+int PluginSampleStreamer::getBufferLengthInSamples(const double sourceSampleRate) const
+{
+    // The preloaded head covers the first read, the ring only has to cover the streamer
+    // catching up with the voice, so it is sized like the head.
+    return juce::jmax(Samples::streamingMinimumBufferLength, getPreloadLengthInSamples(sourceSampleRate));
+}
+
+void PluginSampleStreamer::reportUnderrun(const int numberOfSamples)
+{
+    mUnderrunCount.fetch_add(1, std::memory_order_relaxed);
+    mUnderrunSampleCount.fetch_add(numberOfSamples, std::memory_order_relaxed);
+}
+
+int PluginSampleStreamer::getUnderrunCount() const
+{
+    return mUnderrunCount.load(std::memory_order_relaxed);
+}
+
+juce::int64 PluginSampleStreamer::getUnderrunSampleCount() const
+{
+    return mUnderrunSampleCount.load(std::memory_order_relaxed);
+}
+
+int PluginSampleStreamer::useTimeSlice()
+{
+    bool hasMoreToRead = false;
+
+    {
+        // The audio thread never takes this lock, it only guards voices being added while loading.
+        const juce::ScopedLock sl(mVoicesLock);
+
+        for (auto* voice : mVoices)
+        {
+            hasMoreToRead = voice->fillStreamBuffer() || hasMoreToRead;
+        }
+    }
+
+    return hasMoreToRead ? 0 : 1;
+}
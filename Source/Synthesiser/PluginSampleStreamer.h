@@ -0,0 +1,55 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <vector>
+
+class PluginSynthesiserVoice;
+
+/*
+    Background reader for streaming playback. Sounds keep only a preloaded head in
+    memory; while a voice plays that head, this thread pulls the rest of the sample
+    into a ring buffer the voice took from the streamer's slots.
+*/
+class PluginSampleStreamer : private juce::TimeSliceClient
+{
+public:
+    // One ring per voice, allocated up front so taking one never allocates.
+    struct StreamSlot {
+        juce::AudioBuffer<float> buffer;
+        std::atomic<bool> isInUse { false };
+    };
+
+    PluginSampleStreamer(int preloadMilliseconds, int numberOfSlots);
+    ~PluginSampleStreamer() override;
+
+    void addVoice(PluginSynthesiserVoice* voice);
+    void removeVoice(PluginSynthesiserVoice* voice);
+    void stop();
+
+    // Each voice takes a slot when it is created and gives it back when destroyed. nullptr when
+    // every slot is in use, the voice then plays its preloaded head only.
+    StreamSlot* acquireSlot();
+    void releaseSlot(StreamSlot* slot);
+
+    int getPreloadLengthInSamples(double sourceSampleRate) const;
+    int getBufferLengthInSamples(double sourceSampleRate) const;
+
+    void reportUnderrun(int numberOfSamples);
+    int getUnderrunCount() const;
+    juce::int64 getUnderrunSampleCount() const;
+
+private:
+    int useTimeSlice() override;
+
+    juce::TimeSliceThread mThread;
+    juce::CriticalSection mVoicesLock;
+    juce::Array<PluginSynthesiserVoice*> mVoices;
+    std::vector<std::unique_ptr<StreamSlot>> mSlots;
+
+    const int mPreloadMilliseconds;
+
+    std::atomic<int> mUnderrunCount { 0 };
+    std::atomic<juce::int64> mUnderrunSampleCount { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginSampleStreamer)
+};
@@ -1,101 +1,167 @@
 #include "PluginSynthesiser.h"
 #include "../Configuration/Samples.h"
 #include "PluginSynthesiserVoice.h"
+#include "../PluginUtils.h"
 
 void PluginSynthesiser::noteOff(const int midiChannel, const int midiNoteNumber, const float velocity, const bool allowTailOff) {
     
 }
 
-void PluginSynthesiser::noteOn(const int midiChannel, const int midiNoteNumber, const float velocity, const std::string micId) {
-    if (mMidiNoteToInstruments.find(midiNoteNumber) != mMidiNoteToInstruments.end())
+void PluginSynthesiser::noteOn(const int midiChannel, const int midiNoteNumber, const float velocity, const int micIndex) {
+    const juce::ScopedLock sl(lock);
+    
+    if (midiNoteNumber < 0 || midiNoteNumber >= (int)mInstruments.size())
     {
-        auto& instrument = mMidiNoteToInstruments.at(midiNoteNumber);
-
-        for (auto& voice : voices)
+        return;
+    }
+    
+    auto& instrument = mInstruments[(size_t)midiNoteNumber];
+    
+    if (!instrument.isLoaded.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    
+    chokeNotes(instrument.stopsMidiNotes);
+    
+    auto& intensities = instrument.velocities;
+    
+    int intensityIndex = static_cast<int>(floor(velocity * intensities.size()));
+    intensityIndex = std::min(intensityIndex, (int)intensities.size() - 1);
+    
+    auto& lowerIntensity = intensities[(size_t)intensityIndex];
+    
+    if (lowerIntensity.currentVariationIndex < lowerIntensity.numberOfVariations)
+    {
+        const auto& variation = instrument.variations[(size_t)(lowerIntensity.firstVariation + lowerIntensity.currentVariationIndex)];
+        
+        for (int microphoneIndex = 0; microphoneIndex < variation.numberOfMicrophones; microphoneIndex++)
         {
-            for (int stopsMidiNote : instrument.stopsMidiNotes)
+            const auto& microphone = instrument.microphones[(size_t)(variation.firstMicrophone + microphoneIndex)];
+            
+            if (micIndex < 0 || microphone.micIndex == micIndex)
             {
-                auto currentlyPlayingSounds = voice->getCurrentlyPlayingSound();
-                if (currentlyPlayingSounds != nullptr && currentlyPlayingSounds->appliesToNote(stopsMidiNote))
-                {
-                    voice->stopNote(1, true);
-                }
+                startMicrophone(microphone, midiChannel, midiNoteNumber, velocity);
             }
         }
+        
+        lowerIntensity.currentVariationIndex = (lowerIntensity.currentVariationIndex + 1) % lowerIntensity.numberOfVariations;
+    }
+}
 
-        auto& intensities = instrument.velocities;
-
-        int intensityIndex = static_cast<int>(floor(velocity * intensities.size()));
-        intensityIndex = std::min(intensityIndex, (int)intensities.size() - 1);
-
-        auto& lowerIntensity = intensities[intensityIndex];
-        auto samplesSize = lowerIntensity.variations.size();
+void PluginSynthesiser::noteOn(const int midiChannel, const int midiNoteNumber, const float velocity)
+{
+    noteOn(midiChannel, midiNoteNumber, velocity, -1);
+}
 
-        if (lowerIntensity.currentVariationIndex < samplesSize)
+void PluginSynthesiser::chokeNotes(const NoteMask& midiNotes)
+{
+    if ((mChokeableNotes & midiNotes).none())
+    {
+        return;
+    }
+    
+    for (auto* voice : mActiveVoices)
+    {
+        const int midiNote = voice->getCurrentlyPlayingNote();
+        
+        if (midiNote >= 0 && midiNotes[(size_t)midiNote] && !voice->isReleasing())
         {
-            auto& variation = lowerIntensity.variations[lowerIntensity.currentVariationIndex];
-
-            auto& sound = variation.microphones.at(micId).sound;
-            PluginSynthesiserVoice* voice = variation.microphones.at(micId).voice;
+            voice->stopNote(1, true);
+        }
+    }
+    
+    mChokeableNotes &= ~midiNotes;
+}
 
-            if (sound->appliesToNote(midiNoteNumber) && sound->appliesToChannel(midiChannel))
-            {
-                stopVoice(voice, 1.0f, true);
-                startVoice(voice, sound, midiChannel, midiNoteNumber, velocityToGain(velocity));
-            }
+void PluginSynthesiser::startMicrophone(const Microphone& microphone, const int midiChannel, const int midiNoteNumber, const float velocity)
+{
+    auto* sound = microphone.sound;
+    
+    if (!sound->appliesToNote(midiNoteNumber) || !sound->appliesToChannel(midiChannel))
+    {
+        return;
+    }
+    
+    auto* voice = obtainVoice();
+    voice->setParameters(*microphone.gainParameter, *microphone.panParameter, *microphone.phaseParameter);
+    startVoice(voice, sound, midiChannel, midiNoteNumber, velocityToGain(velocity));
+    mActiveVoices.push_back(voice);
+    mChokeableNotes.set((size_t)midiNoteNumber);
+}
 
-            lowerIntensity.currentVariationIndex = (lowerIntensity.currentVariationIndex + 1) % samplesSize;
-        }
+PluginSynthesiserVoice* PluginSynthesiser::obtainVoice()
+{
+    // Drum hits decay, so the oldest sounding voice stands in for the quietest one.
+    int numberOfSoundingVoices = 0;
+    
+    for (auto* voice : mActiveVoices)
+    {
+        numberOfSoundingVoices += voice->isReleasing() ? 0 : 1;
+    }
+    
+    if (numberOfSoundingVoices >= mPolyphony)
+    {
+        findOldestActiveVoice(false)->fadeOut(Samples::stealFadeMilliseconds / 1000.0f);
+    }
+    
+    if (!mFreeVoices.empty())
+    {
+        auto* voice = mFreeVoices.back();
+        mFreeVoices.pop_back();
+        return voice;
+    }
+    
+    // Every spare voice is still fading, cut the oldest released one short.
+    auto* voice = findOldestActiveVoice(true);
+    
+    if (voice == nullptr)
+    {
+        voice = findOldestActiveVoice(false);
     }
+    
+    voice->stopNote(0.0f, false);
+    mActiveVoices.erase(std::find(mActiveVoices.begin(), mActiveVoices.end(), voice));
+    return voice;
 }
 
-void PluginSynthesiser::noteOn(const int midiChannel, const int midiNoteNumber, const float velocity)
+PluginSynthesiserVoice* PluginSynthesiser::findOldestActiveVoice(const bool releasing)
 {
-    if (mMidiNoteToInstruments.find(midiNoteNumber) != mMidiNoteToInstruments.end())
+    PluginSynthesiserVoice* oldestVoice = nullptr;
+    
+    for (auto* voice : mActiveVoices)
     {
-        auto& instrument = mMidiNoteToInstruments.at(midiNoteNumber);
-        
-        for (auto& voice : voices)
+        if (voice->isReleasing() == releasing && (oldestVoice == nullptr || voice->wasStartedBefore(*oldestVoice)))
         {
-            for (int stopsMidiNote : instrument.stopsMidiNotes)
-            {
-                auto currentlyPlayingSounds = voice->getCurrentlyPlayingSound();
-                if (currentlyPlayingSounds != nullptr && currentlyPlayingSounds->appliesToNote(stopsMidiNote))
-                {
-                    voice->stopNote(1, true);
-                }
-            }
+            oldestVoice = voice;
         }
+    }
+    
+    return oldestVoice;
+}
+
+void PluginSynthesiser::renderVoices(juce::AudioBuffer<float>& outputAudio, int startSample, int numSamples)
+{
+    for (size_t voiceIndex = mActiveVoices.size(); voiceIndex-- > 0;)
+    {
+        auto* voice = mActiveVoices[voiceIndex];
+        voice->renderNextBlock(outputAudio, startSample, numSamples);
         
-        auto& intensities = instrument.velocities;
-        
-        int intensityIndex = static_cast<int>(floor(velocity * intensities.size()));
-        intensityIndex = std::min(intensityIndex, (int)intensities.size() - 1);
-        
-        auto& lowerIntensity = intensities[intensityIndex];
-        auto samplesSize = lowerIntensity.variations.size();
-        
-        if (lowerIntensity.currentVariationIndex < samplesSize)
+        if (!voice->isVoiceActive())
         {
-            auto& variation = lowerIntensity.variations[lowerIntensity.currentVariationIndex];
-
-            for (auto& microphone : variation.microphones)
-            {
-                auto& sound = microphone.second.sound;
-                PluginSynthesiserVoice* voice = microphone.second.voice;
-
-                if (sound->appliesToNote(midiNoteNumber) && sound->appliesToChannel(midiChannel))
-                {
-                    stopVoice(voice, 1.0f, true);
-                    startVoice(voice, sound, midiChannel, midiNoteNumber, velocityToGain(velocity));
-                }
-            }
-
-            lowerIntensity.currentVariationIndex = (lowerIntensity.currentVariationIndex + 1) % samplesSize;
+            mActiveVoices[voiceIndex] = mActiveVoices.back();
+            mActiveVoices.pop_back();
+            mFreeVoices.push_back(voice);
         }
     }
 }
 
+bool PluginSynthesiser::hasActiveVoices()
+{
+    const juce::ScopedLock sl(lock);
+    return !mActiveVoices.empty();
+}
+
 float PluginSynthesiser::velocityToGain(float x) 
 {
     if (x <= 0.05)
@@ -112,9 +178,21 @@ float PluginSynthesiser::velocityToGain(float x)
     }
 }
 
-PluginSynthesiser::PluginSynthesiser()
+PluginSynthesiser::PluginSynthesiser(PluginSampleStreamer* streamer, PluginSampleStorage::Format storageFormat, const int polyphony, const float voiceFloorGain) :
+    mStreamer(streamer),
+    mStorageFormat(storageFormat),
+    mPolyphony(juce::jmax(1, polyphony))
 {
     setNoteStealingEnabled(false);
+    
+    const int numberOfVoices = mPolyphony + Samples::stealFadeVoices;
+    mActiveVoices.reserve((size_t)numberOfVoices);
+    mFreeVoices.reserve((size_t)numberOfVoices);
+    
+    for (int voiceIndex = 0; voiceIndex < numberOfVoices; voiceIndex++)
+    {
+        mFreeVoices.push_back(static_cast<PluginSynthesiserVoice*>(addVoice(new PluginSynthesiserVoice(mStreamer, voiceFloorGain))));
+    }
 }
 
 PluginSynthesiser::~PluginSynthesiser()
@@ -123,61 +201,303 @@ PluginSynthesiser::~PluginSynthesiser()
 }
 
 void PluginSynthesiser::addSample(const std::string resourceName,
+                                  const char* resourceData,
+                                  const int resourceDataSize,
                                   const int bitRate,
                                   const int bitDepth,
                                   const int midiNote,
                                   const std::string micId,
-                                  const std::vector<int> stopsMidiNotes,
                                   const int velocityIndex,
                                   const int variationIndex,
                                   juce::AudioFormatManager& audioFormatManager,
+                                  PluginSamplePool& samplePool,
+                                  juce::int64 startFrame,
+                                  const float tailFloorGain,
                                   juce::RangedAudioParameter& gainParameter,
                                   juce::RangedAudioParameter& panParameter,
                                   juce::AudioParameterBool& phaseParameter
                                   ) {
     juce::BigInteger range;
     range.setRange(midiNote, 1, true);
-    int dataSizeInBytes;
     
-    const char* sourceData = BinaryData::getNamedResource(resourceName.c_str(), dataSizeInBytes);
-    auto memoryInputStream = std::make_unique<juce::MemoryInputStream>(sourceData, dataSizeInBytes, false);
-    juce::AudioFormatReader* reader = audioFormatManager.createReaderFor(std::move(memoryInputStream));
+    auto memoryInputStream = std::make_unique<juce::MemoryInputStream>(resourceData, resourceDataSize, false);
+    std::unique_ptr<juce::AudioFormatReader> reader(audioFormatManager.createReaderFor(std::move(memoryInputStream)));
     
-    double maxSampleLengthSeconds = dataSizeInBytes / (Samples::bitRate * (Samples::bitDepth / 8.0));
-    PluginSynthesiserSound* sound = new PluginSynthesiserSound(juce::String(resourceName), *reader, range, midiNote, 0.0, 0.0, maxSampleLengthSeconds);
+    if (reader == nullptr)
+    {
+        DBG("could not read " + resourceName);
+        return;
+    }
+    
+    double maxSampleLengthSeconds = resourceDataSize / (Samples::bitRate * (Samples::bitDepth / 8.0));
+    int preloadLengthInSamples = mStreamer != nullptr ? mStreamer->getPreloadLengthInSamples(reader->sampleRate) : -1;
+    int tailFadeLength = (int)(reader->sampleRate * Samples::tailFadeMilliseconds / 1000.0);
+    
+    // The streamer reads at absolute source positions, so streamed samples keep their start.
+    if (mStreamer != nullptr)
+    {
+        startFrame = 0;
+    }
     
+    auto sampleData = samplePool.getOrLoad(PluginSamplePool::makeKey(resourceName, mStorageFormat, preloadLengthInSamples, startFrame, tailFloorGain), [&]
+    {
+        return std::make_unique<PluginSampleData>(*reader, maxSampleLengthSeconds, preloadLengthInSamples, mStorageFormat, startFrame, tailFloorGain, tailFadeLength);
+    });
+    
+    auto& trimReport = mInstruments[(size_t)midiNote].trimReport;
+    const auto trimmedFrames = sampleData->mTrimmedLeadingFrames + sampleData->mTrimmedTailFrames;
+    trimReport.numberOfSamples++;
+    trimReport.leadingSecondsRemoved += sampleData->mTrimmedLeadingFrames / sampleData->mSourceSampleRate;
+    trimReport.tailSecondsRemoved += sampleData->mTrimmedTailFrames / sampleData->mSourceSampleRate;
+    trimReport.bytesSaved += (size_t)(trimmedFrames * sampleData->mNumChannels) * sizeof(float);
+    
+    PluginSynthesiserSound* sound = new PluginSynthesiserSound(juce::String(resourceName), std::move(sampleData), range, midiNote, 0.0, 0.0);
+    
+    if (mStreamer != nullptr)
+    {
+        sound->setStreamReader(std::move(reader));
+    }
+    
+    addMicrophone(sound, midiNote, micId, velocityIndex, variationIndex, gainParameter, panParameter, phaseParameter);
+}
+
+void PluginSynthesiser::addKitSample(const PluginKitFile& kitFile,
+                                     const PluginKitFile::Entry& kitFileEntry,
+                                     juce::RangedAudioParameter& gainParameter,
+                                     juce::RangedAudioParameter& panParameter,
+                                     juce::AudioParameterBool& phaseParameter
+                                     ) {
+    juce::BigInteger range;
+    range.setRange(kitFileEntry.midiNote, 1, true);
+    
+    const auto soundName = stringsJoin({ std::to_string(kitFileEntry.midiNote), std::to_string(kitFileEntry.velocityIndex + 1), std::to_string(kitFileEntry.variationIndex + 1), kitFileEntry.micId });
+    auto sampleData = std::make_shared<const PluginSampleData>(kitFile, kitFileEntry);
+    PluginSynthesiserSound* sound = new PluginSynthesiserSound(juce::String(soundName), std::move(sampleData), range, kitFileEntry.midiNote, 0.0, 0.0);
+    
+    addMicrophone(sound, kitFileEntry.midiNote, kitFileEntry.micId, kitFileEntry.velocityIndex, kitFileEntry.variationIndex, gainParameter, panParameter, phaseParameter);
+}
+
+void PluginSynthesiser::addMicrophone(PluginSynthesiserSound* sound,
+                                      const int midiNote,
+                                      const std::string micId,
+                                      const int velocityIndex,
+                                      const int variationIndex,
+                                      juce::RangedAudioParameter& gainParameter,
+                                      juce::RangedAudioParameter& panParameter,
+                                      juce::AudioParameterBool& phaseParameter
+                                      ) {
     addSound(sound);
     
-    auto& instrument = mMidiNoteToInstruments[midiNote];
+    // Nothing reads the instrument's tables until setInstrumentLoaded() publishes it.
+    Microphone microphone;
+    microphone.sound = sound;
+    microphone.gainParameter = &gainParameter;
+    microphone.panParameter = &panParameter;
+    microphone.phaseParameter = &phaseParameter;
+    microphone.micIndex = internMicId(micId);
+    microphone.velocityIndex = velocityIndex;
+    microphone.variationIndex = variationIndex;
     
-    instrument.stopsMidiNotes = stopsMidiNotes;
+    mInstruments[(size_t)midiNote].microphones.push_back(microphone);
+}
+
+int PluginSynthesiser::internMicId(const std::string& micId)
+{
+    const juce::ScopedLock sl(mMicIdsLock);
+    
+    auto micIdIterator = std::find(mMicIds.begin(), mMicIds.end(), micId);
+    
+    if (micIdIterator != mMicIds.end())
+    {
+        return (int)std::distance(mMicIds.begin(), micIdIterator);
+    }
+    
+    mMicIds.push_back(micId);
+    return (int)mMicIds.size() - 1;
+}
+
+int PluginSynthesiser::getMicIndex(const std::string& micId)
+{
+    const juce::ScopedLock sl(mMicIdsLock);
+    
+    auto micIdIterator = std::find(mMicIds.begin(), mMicIds.end(), micId);
+    return micIdIterator != mMicIds.end() ? (int)std::distance(mMicIds.begin(), micIdIterator) : -1;
+}
+
+std::vector<std::pair<PluginKitFile::Entry, const juce::AudioBuffer<float>*>> PluginSynthesiser::getKitFileSamples()
+{
+    std::vector<std::pair<PluginKitFile::Entry, const juce::AudioBuffer<float>*>> samples;
+    const juce::ScopedLock sl(mMicIdsLock);
     
-    while (instrument.velocities.empty() || velocityIndex >= instrument.velocities.size())
+    for (int midiNote = 0; midiNote < (int)mInstruments.size(); midiNote++)
     {
-        instrument.velocities.emplace_back();
+        const auto& instrument = mInstruments[(size_t)midiNote];
+        
+        if (!instrument.isLoaded.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+        
+        for (const auto& microphone : instrument.microphones)
+        {
+            const auto* sound = microphone.sound;
+            
+            if (!sound->isResident())
+            {
+                DBG("cannot export streamed or packed sound " + sound->getName());
+                continue;
+            }
+            
+            PluginKitFile::Entry entry;
+            entry.midiNote = midiNote;
+            entry.velocityIndex = microphone.velocityIndex;
+            entry.variationIndex = microphone.variationIndex;
+            entry.numberOfChannels = sound->getNumChannels();
+            entry.numberOfFrames = sound->mLength;
+            entry.sampleRate = sound->mSourceSampleRate;
+            entry.micId = mMicIds[(size_t)microphone.micIndex];
+            
+            samples.emplace_back(entry, sound->getAudioData());
+        }
     }
     
-    auto& velocity = instrument.velocities[velocityIndex];
-    while (velocity.variations.empty() || variationIndex >= velocity.variations.size())
+    return samples;
+}
+
+size_t PluginSynthesiser::getSampleMemorySize()
+{
+    const juce::ScopedLock sl(lock);
+    size_t memorySize = 0;
+    
+    for (int soundIndex = 0; soundIndex < getNumSounds(); soundIndex++)
     {
-        velocity.variations.emplace_back();
+        memorySize += static_cast<PluginSynthesiserSound*>(getSound(soundIndex).get())->getMemorySize();
     }
     
-    PluginSynthesiserVoice* voice = new PluginSynthesiserVoice(gainParameter, panParameter, phaseParameter);
-    auto microphone = Microphone(sound, voice);
+    return memorySize;
+}
+
+size_t PluginSynthesiser::getUncompressedSampleMemorySize()
+{
+    const juce::ScopedLock sl(lock);
+    size_t memorySize = 0;
     
-    addVoice(voice);
-    velocity.variations[variationIndex].microphones.emplace(
-        micId,
-        std::move(microphone)
-    );
+    for (int soundIndex = 0; soundIndex < getNumSounds(); soundIndex++)
+    {
+        memorySize += static_cast<PluginSynthesiserSound*>(getSound(soundIndex).get())->getUncompressedMemorySize();
+    }
+    
+    return memorySize;
+}
+
+void PluginSynthesiser::addInstrument(const int midiNote, const std::vector<int> stopsMidiNotes)
+{
+    auto& instrument = mInstruments[(size_t)midiNote];
+    instrument.isAdded = true;
+    
+    for (int stopsMidiNote : stopsMidiNotes)
+    {
+        instrument.stopsMidiNotes.set((size_t)stopsMidiNote);
+    }
+}
+
+void PluginSynthesiser::setInstrumentLoaded(const int midiNote)
+{
+    auto& instrument = mInstruments[(size_t)midiNote];
+    auto& microphones = instrument.microphones;
+    
+    std::sort(microphones.begin(), microphones.end(), [](const Microphone& a, const Microphone& b)
+    {
+        return std::tie(a.velocityIndex, a.variationIndex, a.micIndex) < std::tie(b.velocityIndex, b.variationIndex, b.micIndex);
+    });
+    
+    const int numberOfVelocities = microphones.empty() ? 1 : microphones.back().velocityIndex + 1;
+    instrument.velocities.assign((size_t)numberOfVelocities, Intensity());
+    instrument.variations.clear();
+    
+    // Missing velocities or variations keep an empty slot, as they always have.
+    int microphoneIndex = 0;
+    
+    for (int velocityIndex = 0; velocityIndex < numberOfVelocities; velocityIndex++)
+    {
+        auto& intensity = instrument.velocities[(size_t)velocityIndex];
+        intensity.firstVariation = (int)instrument.variations.size();
+        
+        for (int variationIndex = 0; microphoneIndex < (int)microphones.size() && microphones[(size_t)microphoneIndex].velocityIndex == velocityIndex; variationIndex++)
+        {
+            Variation variation;
+            variation.firstMicrophone = microphoneIndex;
+            
+            while (microphoneIndex < (int)microphones.size()
+                   && microphones[(size_t)microphoneIndex].velocityIndex == velocityIndex
+                   && microphones[(size_t)microphoneIndex].variationIndex == variationIndex)
+            {
+                microphoneIndex++;
+            }
+            
+            variation.numberOfMicrophones = microphoneIndex - variation.firstMicrophone;
+            instrument.variations.push_back(variation);
+        }
+        
+        intensity.numberOfVariations = (int)instrument.variations.size() - intensity.firstVariation;
+    }
+    
+    instrument.isLoaded.store(true, std::memory_order_release);
+}
+
+juce::int64 PluginSynthesiser::findSampleStart(const char* resourceData,
+                                               const int resourceDataSize,
+                                               juce::AudioFormatManager& audioFormatManager,
+                                               const float thresholdGain)
+{
+    auto memoryInputStream = std::make_unique<juce::MemoryInputStream>(resourceData, resourceDataSize, false);
+    std::unique_ptr<juce::AudioFormatReader> reader(audioFormatManager.createReaderFor(std::move(memoryInputStream)));
+    
+    if (reader == nullptr || thresholdGain <= 0.0f)
+    {
+        return 0;
+    }
+    
+    return juce::jmax((juce::int64)0, reader->searchForLevel(0, reader->lengthInSamples, thresholdGain, 1.0, 1));
+}
+
+std::map<int, PluginSynthesiser::TrimReport> PluginSynthesiser::getTrimReports()
+{
+    std::map<int, TrimReport> trimReports;
+    
+    for (int midiNote = 0; midiNote < (int)mInstruments.size(); midiNote++)
+    {
+        if (mInstruments[(size_t)midiNote].isLoaded.load(std::memory_order_acquire))
+        {
+            trimReports[midiNote] = mInstruments[(size_t)midiNote].trimReport;
+        }
+    }
+    
+    return trimReports;
+}
+
+void PluginSynthesiser::resampleInstrument(const int midiNote, const double sampleRate)
+{
+    const auto& instrument = mInstruments[(size_t)midiNote];
+    
+    if (!instrument.isLoaded.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    
+    for (const auto& microphone : instrument.microphones)
+    {
+        microphone.sound->prepareResampledData(sampleRate);
+    }
 }
 
 std::vector<int> PluginSynthesiser::getMidiNotesVector()
 {
     std::vector<int> keys;
-    for (const auto& pair : mMidiNoteToInstruments) {
-        keys.push_back(pair.first); // Collect the keys
+    for (int midiNote = 0; midiNote < (int)mInstruments.size(); midiNote++) {
+        if (mInstruments[(size_t)midiNote].isAdded) {
+            keys.push_back(midiNote);
+        }
     }
     return keys;
 }
@@ -1,73 +1,150 @@
 #pragma once
 #include <JuceHeader.h>
 #include <vector>
+#include <atomic>
+#include <bitset>
+#include <array>
+#include <tuple>
 #include "PluginSynthesiserVoice.h"
 #include "PluginSynthesiserSound.h"
+#include "PluginSampleStreamer.h"
+#include "PluginKitFile.h"
+#include "PluginSampleStorage.h"
+#include "PluginSamplePool.h"
 #include "../Configuration/Samples.h"
 
 class PluginSynthesiser : public juce::Synthesiser {
     
 public:
-    PluginSynthesiser();
+    // What load-time trimming removed from an instrument, summed over its samples.
+    struct TrimReport {
+        int numberOfSamples = 0;
+        double leadingSecondsRemoved = 0.0; // trigger to transient latency saved
+        double tailSecondsRemoved = 0.0; // voice time saved
+        size_t bytesSaved = 0; // as resident float
+    };
+    
+    PluginSynthesiser(PluginSampleStreamer* streamer = nullptr,
+                      PluginSampleStorage::Format storageFormat = PluginSampleStorage::Format::float32,
+                      int polyphony = Samples::polyphonyDefault,
+                      float voiceFloorGain = 0.0f);
     ~PluginSynthesiser();
     
-    virtual void noteOn(int midiChannel, int midiNoteNumber, float velocity, std::string micId);
+    virtual void noteOn(int midiChannel, int midiNoteNumber, float velocity, int micIndex);
     virtual void noteOn(int midiChannel, int midiNoteNumber, float velocity) override;
     virtual void noteOff(int midiChannel, int midiNoteNumber, float velocity, bool allowTailOff) override;
     
+    void addInstrument(const int midiNote, const std::vector<int> stopsMidiNotes);
+    void setInstrumentLoaded(const int midiNote); // groups the instrument's microphones, then publishes it
+    int getMicIndex(const std::string& micId); // -1 when no sample uses the mic
+    void resampleInstrument(const int midiNote, const double sampleRate); // off the audio thread, once loaded
+    
     void addSample(const std::string resourceName,
+                   const char* resourceData,
+                   const int resourceDataSize,
                    const int bitRate,
                    const int bitDepth,
                    const int midiNote,
                    const std::string micId,
-                   const std::vector<int> stopsMidiNotes,
                    const int intensityIndex,
                    const int variationIndex,
                    juce::AudioFormatManager& audioFormatManager,
+                   PluginSamplePool& samplePool,
+                   juce::int64 startFrame,
+                   const float tailFloorGain,
                    juce::RangedAudioParameter& gainParameter,
                    juce::RangedAudioParameter& panParameter,
                    juce::AudioParameterBool& phaseParameter
                    );
     
+    void addKitSample(const PluginKitFile& kitFile,
+                      const PluginKitFile::Entry& kitFileEntry,
+                      juce::RangedAudioParameter& gainParameter,
+                      juce::RangedAudioParameter& panParameter,
+                      juce::AudioParameterBool& phaseParameter
+                      );
+    
+    static juce::int64 findSampleStart(const char* resourceData, const int resourceDataSize, juce::AudioFormatManager& audioFormatManager, const float thresholdGain);
+    std::map<int, TrimReport> getTrimReports(); // loaded instruments only
+    
+    bool hasActiveVoices();
+    
     std::vector<int> getMidiNotesVector();
+    std::vector<std::pair<PluginKitFile::Entry, const juce::AudioBuffer<float>*>> getKitFileSamples();
+    size_t getSampleMemorySize(); // bytes referenced by all sounds, pooled and mapped kit data included
+    size_t getUncompressedSampleMemorySize(); // the same sounds held as resident float
     
 protected:
     
+    using NoteMask = std::bitset<128>; // one bit per MIDI note
+    
     struct Microphone {
         PluginSynthesiserSound* sound;
-        PluginSynthesiserVoice* voice; 
-
-        Microphone() = default; 
-        
-        Microphone(PluginSynthesiserSound*  s, PluginSynthesiserVoice* v)
-        : sound(s), voice(v)
-        {}
+        juce::RangedAudioParameter* gainParameter;
+        juce::RangedAudioParameter* panParameter;
+        juce::AudioParameterBool* phaseParameter;
+        int micIndex; // into mMicIds
+        int velocityIndex;
+        int variationIndex;
     };
     
     struct Variation {
-        std::map<std::string, Microphone> microphones;
-        
-        Variation() {}
+        int firstMicrophone = 0;
+        int numberOfMicrophones = 0;
     };
     
     struct Intensity {
-        int currentVariationIndex;
-        std::vector<Variation> variations;
-        
-        Intensity() : currentVariationIndex(0) { }
+        int firstVariation = 0;
+        int numberOfVariations = 0;
+        int currentVariationIndex = 0;
     };
     
+    // Microphones are appended in load order and grouped by velocity, variation and mic once
+    // the instrument is loaded, so note on resolves everything by indexing flat arrays.
     struct Instrument {
         std::vector<Intensity> velocities;
-        std::vector<int> stopsMidiNotes;
-        
-        Instrument() {
-            velocities.emplace_back();
-        }
+        std::vector<Variation> variations;
+        std::vector<Microphone> microphones;
+        NoteMask stopsMidiNotes;
+        bool isAdded = false;
+        std::atomic<bool> isLoaded { false }; // published by the loader once every sample is decoded
+        TrimReport trimReport;
     };
     
-    std::map<int, Instrument> mMidiNoteToInstruments;
+    std::array<Instrument, 128> mInstruments; // indexed by MIDI note
+    
+    std::vector<std::string> mMicIds; // interned at load time, indexed by Microphone::micIndex
+    juce::CriticalSection mMicIdsLock; // instruments of one synthesiser load concurrently
+    
+    // Voices that are playing or tailing off, so rendering and choking scale with
+    // polyphony rather than with the number of loaded samples.
+    std::vector<PluginSynthesiserVoice*> mActiveVoices;
+    std::vector<PluginSynthesiserVoice*> mFreeVoices; // the rest of the preallocated pool
+    
+    // Notes that may still have a voice which is not releasing. Bits are set on note on and
+    // cleared once choked, a voice ending by itself leaves its bit until the next choke scan.
+    NoteMask mChokeableNotes;
+    
+    void renderVoices(juce::AudioBuffer<float>& outputAudio, int startSample, int numSamples) override;
 
 private:
+    PluginSampleStreamer* mStreamer;
+    PluginSampleStorage::Format mStorageFormat;
+    int mPolyphony;
+    
+    void addMicrophone(PluginSynthesiserSound* sound,
+                       const int midiNote,
+                       const std::string micId,
+                       const int velocityIndex,
+                       const int variationIndex,
+                       juce::RangedAudioParameter& gainParameter,
+                       juce::RangedAudioParameter& panParameter,
+                       juce::AudioParameterBool& phaseParameter
+                       );
+    int internMicId(const std::string& micId);
+    void chokeNotes(const NoteMask& midiNotes);
+    void startMicrophone(const Microphone& microphone, int midiChannel, int midiNoteNumber, float velocity);
+    PluginSynthesiserVoice* obtainVoice();
+    PluginSynthesiserVoice* findOldestActiveVoice(bool releasing);
     float velocityToGain(float x);
 };
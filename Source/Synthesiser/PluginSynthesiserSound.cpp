@@ -1,28 +1,22 @@
 #include "PluginSynthesiserSound.h"
 
 PluginSynthesiserSound::PluginSynthesiserSound(const juce::String& soundName,
-                                               juce::AudioFormatReader& source,
+                                               std::shared_ptr<const PluginSampleData> sampleData,
                                                const juce::BigInteger& notes,
                                                int midiNoteForNormalPitch,
                                                double attackTimeSecs,
-                                               double releaseTimeSecs,
-                                               double maxSampleLengthSeconds) :
-mSourceSampleRate(source.sampleRate),
+                                               double releaseTimeSecs) :
+mSampleData(std::move(sampleData)),
+mSourceSampleRate(mSampleData->mSourceSampleRate),
+mLength(mSampleData->mLength),
+mPreloadLength(mSampleData->mPreloadLength),
+mNumChannels(mSampleData->mNumChannels),
 mName(soundName),
 mMidiNotes(notes),
 mMidiRootNote(midiNoteForNormalPitch)
 {
-    if (mSourceSampleRate > 0 && source.lengthInSamples > 0)
-    {
-        mLength = juce::jmin((int)source.lengthInSamples, (int)(maxSampleLengthSeconds * mSourceSampleRate));
-        
-        mData.reset(new juce::AudioBuffer<float>(juce::jmin(2, (int)source.numChannels), mLength + 4));
-        
-        source.read(mData.get(), 0, mLength + 4, 0, true, true);
-        
-        mAdsrParameters.attack = static_cast<float> (attackTimeSecs);
-        mAdsrParameters.release = static_cast<float> (releaseTimeSecs);
-    }
+    mAdsrParameters.attack = static_cast<float> (attackTimeSecs);
+    mAdsrParameters.release = static_cast<float> (releaseTimeSecs);
 }
 
 PluginSynthesiserSound::~PluginSynthesiserSound()
@@ -30,6 +24,19 @@ PluginSynthesiserSound::~PluginSynthesiserSound()
     DBG("~PluginSynthesiserSound()");
 }
 
+void PluginSynthesiserSound::setStreamReader(std::unique_ptr<juce::AudioFormatReader> reader)
+{
+    if (mPreloadLength < mLength)
+    {
+        mStreamReader = std::move(reader);
+    }
+}
+
+void PluginSynthesiserSound::readStreamFrames(juce::AudioBuffer<float>& destination, const int destinationStartSample, const juce::int64 sourceStartSample, const int numberOfSamples)
+{
+    mStreamReader->read(&destination, destinationStartSample, numberOfSamples, sourceStartSample, true, true);
+}
+
 bool PluginSynthesiserSound::appliesToNote(int midiNoteNumber)
 {
     return mMidiNotes[midiNoteNumber];
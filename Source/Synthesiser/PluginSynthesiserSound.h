@@ -1,29 +1,53 @@
 #pragma once
 #include <JuceHeader.h>
+#include <atomic>
 #include "../Configuration/Samples.h"
+#include "PluginSampleData.h"
 
 class PluginSynthesiserSound : public juce::SynthesiserSound
 {
 public:
     PluginSynthesiserSound(const juce::String& name,
-                           juce::AudioFormatReader& source,
+                           std::shared_ptr<const PluginSampleData> sampleData,
                            const juce::BigInteger& midiNotes,
                            int midiNoteForNormalPitch,
                            double attackTimeSecs,
-                           double releaseTimeSecs,
-                           double maxSampleLengthSeconds);
+                           double releaseTimeSecs);
     
     ~PluginSynthesiserSound() override;
     
     const juce::String& getName() const noexcept { return mName; }
-    juce::AudioBuffer<float>* getAudioData() const noexcept { return mData.get(); }
+    juce::AudioBuffer<float>* getAudioData() const noexcept { return mSampleData->mData.get(); }
     void setEnvelopeParameters(juce::ADSR::Parameters parametersToUse) { mAdsrParameters = parametersToUse; }
     bool appliesToNote(int midiNoteNumber) override;
     bool appliesToChannel(int midiChannel) override;
     
+    int getNumChannels() const noexcept { return mNumChannels; }
+    size_t getMemorySize() const { return mSampleData->getMemorySize(); }
+    size_t getUncompressedMemorySize() const { return mSampleData->getUncompressedMemorySize(); }
+    
+    // Resident float sounds are rendered straight from getAudioData(), everything else is
+    // gathered through readFrames (and the voice's stream buffer when streaming).
+    bool isResident() const noexcept { return getAudioData() != nullptr && !isStreaming(); }
+    void readFrames(int channel, int startFrame, int numberOfFrames, float* destination, PluginCompressedChannel::Cursor* cursor = nullptr) const { mSampleData->readFrames(channel, startFrame, numberOfFrames, destination, cursor); }
+    float getRemainingPeak(int frame) const noexcept { return mSampleData->getRemainingPeak(frame); }
+    
+    // Built off the audio thread by prepareResampledData(); voices check the rate before
+    // using it and fall back to interpolating while it does not match theirs.
+    void prepareResampledData(double sampleRate) { mResampledData.store(mSampleData->getResampled(sampleRate), std::memory_order_release); }
+    const PluginSampleData* getResampledData() const noexcept { return mResampledData.load(std::memory_order_acquire); }
+    
+    bool isStreaming() const noexcept { return mStreamReader != nullptr; }
+    void setStreamReader(std::unique_ptr<juce::AudioFormatReader> reader);
+    void readStreamFrames(juce::AudioBuffer<float>& destination, int destinationStartSample, juce::int64 sourceStartSample, int numberOfSamples);
+    
+    std::shared_ptr<const PluginSampleData> mSampleData; // possibly shared with other plugin instances
+    std::atomic<const PluginSampleData*> mResampledData { nullptr }; // owned by mSampleData
     double mSourceSampleRate;
     int mLength = 0;
-    std::unique_ptr<juce::AudioBuffer<float>> mData;
+    int mPreloadLength = 0; // frames held in memory, equal to mLength unless streaming
+    int mNumChannels = 0;
+    std::unique_ptr<juce::AudioFormatReader> mStreamReader; // only used by the streamer thread
     juce::ADSR::Parameters mAdsrParameters;
     juce::String mName;
     juce::BigInteger mMidiNotes;
@@ -3,18 +3,48 @@
 #include "PluginSynthesiserSound.h"
 #include "../Configuration/Parameters.h"
 
-PluginSynthesiserVoice::PluginSynthesiserVoice(
-    juce::RangedAudioParameter& gainParameter,
-    juce::RangedAudioParameter& panParameter,
-    juce::AudioParameterBool& phaseParameter
-) :
-    mGainParameter(gainParameter), 
-    mPanParameter(panParameter),
-    mInvertPhaseParameter(phaseParameter)
-{ }
+PluginSynthesiserVoice::PluginSynthesiserVoice(PluginSampleStreamer* streamer, const float floorGain) :
+    mFloorGain(floorGain),
+    mStreamer(streamer),
+    mStreamSlot(streamer != nullptr ? streamer->acquireSlot() : nullptr)
+{
+    mScratchBuffer.setSize(2, scratchLength);
+    mRenderBuffer.setSize(4, renderLength);
+    
+    if (mStreamer != nullptr)
+    {
+        mStreamer->addVoice(this);
+    }
+}
 
 PluginSynthesiserVoice::~PluginSynthesiserVoice() {
     DBG("~PluginSynthesiserVoice()");
+    
+    if (mStreamer != nullptr)
+    {
+        mStreamer->removeVoice(this);
+        
+        if (mStreamSlot != nullptr)
+        {
+            mStreamer->releaseSlot(mStreamSlot);
+        }
+    }
+}
+
+void PluginSynthesiserVoice::setParameters(juce::RangedAudioParameter& gainParameter, juce::RangedAudioParameter& panParameter, juce::AudioParameterBool& phaseParameter)
+{
+    mGainParameter = &gainParameter;
+    mPanParameter = &panParameter;
+    mInvertPhaseParameter = &phaseParameter;
+}
+
+void PluginSynthesiserVoice::fadeOut(const float seconds)
+{
+    auto parameters = mAdsr.getParameters();
+    parameters.release = seconds;
+    mAdsr.setParameters(parameters);
+    mAdsr.noteOff();
+    mIsReleasing = true;
 }
 
 bool PluginSynthesiserVoice::canPlaySound(juce::SynthesiserSound* sound)
@@ -26,16 +56,53 @@ void PluginSynthesiserVoice::startNote(int midiNoteNumber, float velocity, juce:
 {
     if (auto* sound = dynamic_cast<const PluginSynthesiserSound*> (s))
     {
-        mPitchRatio = std::pow(2.0, (midiNoteNumber - sound->mMidiRootNote) / 12.0)
-            * sound->mSourceSampleRate / getSampleRate();
+        mResampledData = sound->getResampledData();
+        
+        if (mResampledData != nullptr && mResampledData->mSourceSampleRate == getSampleRate() && midiNoteNumber == sound->mMidiRootNote)
+        {
+            mPitchRatio = 1.0;
+            mSourceLength = mResampledData->mLength;
+        }
+        else
+        {
+            mResampledData = nullptr;
+            mPitchRatio = std::pow(2.0, (midiNoteNumber - sound->mMidiRootNote) / 12.0)
+                * sound->mSourceSampleRate / getSampleRate();
+            mSourceLength = sound->mLength;
+        }
 
         mSourceSamplePosition = 0.0;
+        mIsReleasing = false;
+        
+        for (auto& cursor : mDecodeCursors)
+        {
+            cursor.blockIndex = -1;
+        }
         
         mVelocityGain = velocity;
         
+        updateGainTargets();
+        mGainLeft = mTargetGainLeft;
+        mGainRight = mTargetGainRight;
+        
         mAdsr.setSampleRate(sound->mSourceSampleRate);
         mAdsr.setParameters(sound->mAdsrParameters);
         mAdsr.noteOn();
+        
+        if (mStreamer != nullptr)
+        {
+            const bool isStreaming = sound->isStreaming() && mStreamSlot != nullptr;
+            
+            // Without a ring the voice ends with its preloaded head rather than running on silent.
+            if (sound->isStreaming() && !isStreaming)
+            {
+                mSourceLength = juce::jmin(mSourceLength, sound->mPreloadLength - 1);
+            }
+            
+            mStreamReadPosition.store(sound->mPreloadLength, std::memory_order_release);
+            mStreamSound.store(isStreaming ? const_cast<PluginSynthesiserSound*>(sound) : nullptr, std::memory_order_release);
+            mStreamRequestGeneration.fetch_add(1, std::memory_order_release);
+        }
     }
     else
     {
@@ -48,11 +115,18 @@ void PluginSynthesiserVoice::stopNote(float velocity, bool allowTailOff)
     if (allowTailOff)
     {
         mAdsr.noteOff();
+        mIsReleasing = true;
     }
     else
     {
         clearCurrentNote();
         mAdsr.reset();
+        
+        if (mStreamer != nullptr)
+        {
+            mStreamSound.store(nullptr, std::memory_order_release);
+            mStreamRequestGeneration.fetch_add(1, std::memory_order_release);
+        }
     }
 }
 
@@ -60,59 +134,334 @@ void PluginSynthesiserVoice::pitchWheelMoved(int newValue) {}
 void PluginSynthesiserVoice::controllerMoved(int controllerNumber, int newValue) {}
 
 
+namespace
+{
+    // Linear interpolation of numberOfFrames frames, position relative to in. Positions are
+    // taken relative to the first frame read, small enough for float to keep their fractions,
+    // which spares the double arithmetic per frame. The indexed reads still keep the loop scalar.
+    template <bool isSourceStereo>
+    void interpolateFrames(const float* inL, const float* inR, const double position, const double pitchRatio, float* frameL, float* frameR, const int numberOfFrames)
+    {
+        const int firstIndex = (int)position;
+        const float firstFraction = (float)(position - (double)firstIndex);
+        const float step = (float)pitchRatio;
+        
+        inL += firstIndex;
+        inR += isSourceStereo ? firstIndex : 0;
+        
+        for (int frame = 0; frame < numberOfFrames; frame++)
+        {
+            const float framePosition = firstFraction + (float)frame * step;
+            const int index = (int)framePosition;
+            const float alpha = framePosition - (float)index;
+            
+            frameL[frame] = inL[index] + alpha * (inL[index + 1] - inL[index]);
+            
+            if (isSourceStereo)
+            {
+                frameR[frame] = inR[index] + alpha * (inR[index + 1] - inR[index]);
+            }
+        }
+    }
+    
+    // Adds the frames to the output with per-frame gains. gainL and gainR are used as scratch.
+    template <bool isSourceStereo, bool isDestinationStereo>
+    void mixFrames(const float* frameL, const float* frameR, float* gainL, float* gainR, float* outL, float* outR, const int numberOfFrames)
+    {
+        if (isDestinationStereo)
+        {
+            juce::FloatVectorOperations::addWithMultiply(outL, frameL, gainL, numberOfFrames);
+            juce::FloatVectorOperations::addWithMultiply(outR, isSourceStereo ? frameR : frameL, gainR, numberOfFrames);
+        }
+        else if (isSourceStereo)
+        {
+            juce::FloatVectorOperations::multiply(gainL, 0.5f, numberOfFrames);
+            juce::FloatVectorOperations::multiply(gainR, 0.5f, numberOfFrames);
+            juce::FloatVectorOperations::addWithMultiply(outL, frameL, gainL, numberOfFrames);
+            juce::FloatVectorOperations::addWithMultiply(outL, frameR, gainR, numberOfFrames);
+        }
+        else
+        {
+            juce::FloatVectorOperations::add(gainL, gainR, numberOfFrames);
+            juce::FloatVectorOperations::multiply(gainL, 0.5f, numberOfFrames);
+            juce::FloatVectorOperations::addWithMultiply(outL, frameL, gainL, numberOfFrames);
+        }
+    }
+}
+
 void PluginSynthesiserVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
 {
     if (auto* playingSound = static_cast<PluginSynthesiserSound*> (getCurrentlyPlayingSound().get()))
     {
-        auto& data = *playingSound->mData;
-        const float* const inL = data.getReadPointer(0);
-        const float* const inR = data.getNumChannels() > 1 ? data.getReadPointer(1) : nullptr;
-        
         float* outL = outputBuffer.getWritePointer(0, startSample);
         float* outR = outputBuffer.getNumChannels() > 1 ? outputBuffer.getWritePointer(1, startSample) : nullptr;
         
-        while (--numSamples >= 0)
+        // Parameters are read once per block and ramped to over it.
+        updateGainTargets();
+        const float gainLeftStep = (mTargetGainLeft - mGainLeft) / (float)numSamples;
+        const float gainRightStep = (mTargetGainRight - mGainRight) / (float)numSamples;
+        
+        if (mFloorGain > 0.0f)
+        {
+            const int position = (int)mSourceSamplePosition;
+            const float remainingPeak = mResampledData != nullptr ? mResampledData->getRemainingPeak(position) : playingSound->getRemainingPeak(position);
+            const float maximumGain = juce::jmax(std::abs(mGainLeft), std::abs(mGainRight), std::abs(mTargetGainLeft), std::abs(mTargetGainRight));
+            
+            if (remainingPeak * maximumGain < mFloorGain)
+            {
+                stopNote(0.0f, false);
+                return;
+            }
+        }
+        
+        float* frameL = mRenderBuffer.getWritePointer(0);
+        float* frameR = mRenderBuffer.getWritePointer(1);
+        float* gainL = mRenderBuffer.getWritePointer(2);
+        float* gainR = mRenderBuffer.getWritePointer(3);
+        
+        while (numSamples > 0)
         {
-            auto pos = (int)mSourceSamplePosition;
-            auto alpha = (float)(mSourceSamplePosition - pos);
-            auto invAlpha = 1.0f - alpha;
+            // Resident sounds are read in place; packed and streamed sounds are decoded into
+            // scratch a chunk at a time.
+            const float* inL;
+            const float* inR;
+            juce::int64 firstFrame = 0;
+            int numChunkSamples = juce::jmin(numSamples, renderLength);
+            
+            if (mResampledData != nullptr)
+            {
+                auto& data = *mResampledData->mData;
+                inL = data.getReadPointer(0);
+                inR = data.getNumChannels() > 1 ? data.getReadPointer(1) : nullptr;
+            }
+            else if (playingSound->isResident())
+            {
+                auto& data = *playingSound->getAudioData();
+                inL = data.getReadPointer(0);
+                inR = data.getNumChannels() > 1 ? data.getReadPointer(1) : nullptr;
+            }
+            else
+            {
+                firstFrame = (juce::int64)mSourceSamplePosition;
+                numChunkSamples = juce::jmin(numChunkSamples, juce::jmax(1, (int)((scratchLength - 3) / mPitchRatio)));
+                
+                fetchFrames(*playingSound, firstFrame, (int)std::ceil(numChunkSamples * mPitchRatio) + 2);
+                
+                inL = mScratchBuffer.getReadPointer(0);
+                inR = playingSound->getNumChannels() > 1 ? mScratchBuffer.getReadPointer(1) : nullptr;
+            }
             
-            float l = (inL[pos] * invAlpha + inL[pos + 1] * alpha);
-            float r = (inR != nullptr) ? (inR[pos] * invAlpha + inR[pos + 1] * alpha) : l;
+            // The end of the sample is found once per chunk rather than tested every frame.
+            const int numFramesToEnd = (int)((mSourceLength - mSourceSamplePosition) / mPitchRatio) + 1;
+            const bool isEndOfSample = numFramesToEnd <= numChunkSamples;
+            numChunkSamples = juce::jmin(numChunkSamples, numFramesToEnd);
             
-            auto envelopeValue = mAdsr.getNextSample();
+            const double position = mSourceSamplePosition - (double)firstFrame;
+            const bool isSourceStereo = inR != nullptr;
+            const float* sourceL;
+            const float* sourceR;
             
-            float panValue = mPanParameter.getValue();
-            float panNormalisedValue = AudioParameters::panNormalisableRange.convertFrom0to1(panValue);
-            float panLeft = panNormalisedValue <= 0.0f ? 1.0f : 1.0f - panNormalisedValue;
-            float panRight = panNormalisedValue >= 0.0f ? 1.0f : 1.0f + panNormalisedValue;
+            if (mPitchRatio == 1.0 && position == std::floor(position))
+            {
+                sourceL = inL + (int)position;
+                sourceR = isSourceStereo ? inR + (int)position : nullptr;
+            }
+            else
+            {
+                if (isSourceStereo)
+                {
+                    interpolateFrames<true>(inL, inR, position, mPitchRatio, frameL, frameR, numChunkSamples);
+                }
+                else
+                {
+                    interpolateFrames<false>(inL, inR, position, mPitchRatio, frameL, frameR, numChunkSamples);
+                }
+                
+                sourceL = frameL;
+                sourceR = frameR;
+            }
             
-            float phaseMultiplier = mInvertPhaseParameter.get() ? -1 : 1;
-
-            float normalizedGainValue = mGainParameter.getValue(); // Get the normalized value
-            float gainDecibelValue = AudioParameters::gainNormalisableRange.convertFrom0to1(normalizedGainValue);
-            float gainFactor = std::pow(10.0f, gainDecibelValue / 20.0f);
+            // The envelope is a state machine stepped one frame at a time; the gain ramps
+            // applied to it are computed from the frame index so that loop vectorises.
+            for (int frame = 0; frame < numChunkSamples; frame++)
+            {
+                gainL[frame] = mAdsr.getNextSample();
+            }
+            
+            const float chunkGainLeft = mGainLeft;
+            const float chunkGainRight = mGainRight;
+            
+            for (int frame = 0; frame < numChunkSamples; frame++)
+            {
+                const float rampFrames = (float)(frame + 1);
+                gainR[frame] = (chunkGainRight + rampFrames * gainRightStep) * gainL[frame];
+                gainL[frame] = (chunkGainLeft + rampFrames * gainLeftStep) * gainL[frame];
+            }
             
-            l *= panLeft * envelopeValue * gainFactor * mVelocityGain * phaseMultiplier;
-            r *= panRight * envelopeValue * gainFactor * mVelocityGain * phaseMultiplier;
+            mGainLeft += (float)numChunkSamples * gainLeftStep;
+            mGainRight += (float)numChunkSamples * gainRightStep;
             
             if (outR != nullptr)
             {
-                *outL++ += l;
-                *outR++ += r;
+                if (isSourceStereo)
+                {
+                    mixFrames<true, true>(sourceL, sourceR, gainL, gainR, outL, outR, numChunkSamples);
+                }
+                else
+                {
+                    mixFrames<false, true>(sourceL, sourceR, gainL, gainR, outL, outR, numChunkSamples);
+                }
+                
+                outR += numChunkSamples;
             }
             else
             {
-                *outL++ += (l + r) * 0.5f;
+                if (isSourceStereo)
+                {
+                    mixFrames<true, false>(sourceL, sourceR, gainL, gainR, outL, outR, numChunkSamples);
+                }
+                else
+                {
+                    mixFrames<false, false>(sourceL, sourceR, gainL, gainR, outL, outR, numChunkSamples);
+                }
             }
             
-            mSourceSamplePosition += mPitchRatio;
+            outL += numChunkSamples;
+            numSamples -= numChunkSamples;
+            mSourceSamplePosition += numChunkSamples * mPitchRatio;
             
-            if (mSourceSamplePosition > playingSound->mLength)
+            // Also ends voices whose release (after a choke) has finished.
+            if (isEndOfSample || !mAdsr.isActive())
             {
                 stopNote(0.0f, false);
-                break;
+                return;
+            }
+            
+            if (playingSound->isStreaming())
+            {
+                mStreamReadPosition.store(juce::jmax((juce::int64)playingSound->mPreloadLength, (juce::int64)mSourceSamplePosition), std::memory_order_release);
             }
         }
     }
 }
+
+void PluginSynthesiserVoice::updateGainTargets()
+{
+    float panNormalisedValue = AudioParameters::panNormalisableRange.convertFrom0to1(mPanParameter->getValue());
+    float panLeft = panNormalisedValue <= 0.0f ? 1.0f : 1.0f - panNormalisedValue;
+    float panRight = panNormalisedValue >= 0.0f ? 1.0f : 1.0f + panNormalisedValue;
+    
+    float phaseMultiplier = mInvertPhaseParameter->get() ? -1.0f : 1.0f;
+    
+    float gainDecibelValue = AudioParameters::gainNormalisableRange.convertFrom0to1(mGainParameter->getValue());
+    float gainFactor = juce::Decibels::decibelsToGain(gainDecibelValue, -1000.0f);
+    
+    mTargetGainLeft = panLeft * gainFactor * mVelocityGain * phaseMultiplier;
+    mTargetGainRight = panRight * gainFactor * mVelocityGain * phaseMultiplier;
+}
+
+void PluginSynthesiserVoice::fetchFrames(const PluginSynthesiserSound& sound, const juce::int64 firstFrame, const int numberOfFrames)
+{
+    const int numChannels = sound.getNumChannels();
+    const juce::int64 headEnd = sound.isStreaming() ? sound.mPreloadLength : sound.mPreloadLength + 4;
+    const int numberOfHeadFrames = (int)juce::jlimit((juce::int64)0, (juce::int64)numberOfFrames, headEnd - firstFrame);
+    
+    for (int channel = 0; channel < numChannels; channel++)
+    {
+        float* destination = mScratchBuffer.getWritePointer(channel);
+        
+        if (numberOfHeadFrames > 0)
+        {
+            sound.readFrames(channel, (int)firstFrame, numberOfHeadFrames, destination, mDecodeCursors + juce::jmin(channel, 1));
+        }
+        
+        if (numberOfHeadFrames < numberOfFrames)
+        {
+            juce::FloatVectorOperations::clear(destination + numberOfHeadFrames, numberOfFrames - numberOfHeadFrames);
+        }
+    }
+    
+    if (!sound.isStreaming() || numberOfHeadFrames == numberOfFrames)
+    {
+        return;
+    }
+    
+    // The rest comes from the ring, up to what the streamer has delivered so far. Voices without
+    // a ring end with their head, so they never get here.
+    auto* slot = mStreamSlot;
+    const int ringLength = slot != nullptr ? slot->buffer.getNumSamples() : 1;
+    const bool isStreamReady = slot != nullptr && mStreamReadyGeneration.load(std::memory_order_acquire) == mStreamRequestGeneration.load(std::memory_order_relaxed);
+    const juce::int64 writePosition = isStreamReady ? mStreamWritePosition.load(std::memory_order_acquire) : sound.mPreloadLength;
+    
+    const juce::int64 tailStart = firstFrame + numberOfHeadFrames;
+    const int numberOfTailFrames = numberOfFrames - numberOfHeadFrames;
+    const int numberOfAvailableFrames = (int)juce::jlimit((juce::int64)0, (juce::int64)numberOfTailFrames, writePosition - tailStart);
+    
+    for (int channel = 0; channel < numChannels && numberOfAvailableFrames > 0; channel++)
+    {
+        float* destination = mScratchBuffer.getWritePointer(channel, numberOfHeadFrames);
+        const float* ring = slot->buffer.getReadPointer(channel);
+        
+        for (int frame = 0; frame < numberOfAvailableFrames; frame++)
+        {
+            destination[frame] = ring[(tailStart + frame) % ringLength];
+        }
+    }
+    
+    const int numberOfMissingFrames = (int)juce::jlimit((juce::int64)0, (juce::int64)(numberOfTailFrames - numberOfAvailableFrames), sound.mLength + 1 - (tailStart + numberOfAvailableFrames));
+    
+    if (numberOfMissingFrames > 0)
+    {
+        mStreamer->reportUnderrun(numberOfMissingFrames);
+    }
+}
+
+bool PluginSynthesiserVoice::fillStreamBuffer()
+{
+    const int requestGeneration = mStreamRequestGeneration.load(std::memory_order_acquire);
+    auto* sound = mStreamSound.load(std::memory_order_acquire);
+    auto* slot = mStreamSlot;
+    
+    if (requestGeneration != mStreamerGeneration)
+    {
+        mStreamerGeneration = requestGeneration;
+        
+        if (sound != nullptr)
+        {
+            mStreamWritePosition.store(sound->mPreloadLength, std::memory_order_release);
+        }
+        
+        mStreamReadyGeneration.store(requestGeneration, std::memory_order_release);
+    }
+    
+    if (sound == nullptr || slot == nullptr)
+    {
+        return false;
+    }
+    
+    const int ringLength = slot->buffer.getNumSamples();
+    const juce::int64 endPosition = sound->mLength + 4;
+    juce::int64 writePosition = mStreamWritePosition.load(std::memory_order_relaxed);
+    const juce::int64 readPosition = mStreamReadPosition.load(std::memory_order_acquire);
+    
+    const int numberOfFreeFrames = ringLength - (int)(writePosition - readPosition);
+    const int numberOfFramesToRead = (int)juce::jmin((juce::int64)numberOfFreeFrames, endPosition - writePosition);
+    
+    if (numberOfFramesToRead <= 0)
+    {
+        return false;
+    }
+    
+    // Read up to the end of the ring, the wrapped part is picked up on the next slice.
+    const int ringStart = (int)(writePosition % ringLength);
+    const int numberOfFramesInSlice = juce::jmin(numberOfFramesToRead, ringLength - ringStart);
+    
+    sound->readStreamFrames(slot->buffer, ringStart, writePosition, numberOfFramesInSlice);
+    
+    if (mStreamRequestGeneration.load(std::memory_order_acquire) == requestGeneration)
+    {
+        mStreamWritePosition.store(writePosition + numberOfFramesInSlice, std::memory_order_release);
+    }
+    
+    return true;
+}
@@ -1,15 +1,17 @@
 #pragma once
 #include <JuceHeader.h>
+#include <atomic>
 #include "../Configuration/Samples.h"
+#include "PluginSampleStreamer.h"
+#include "PluginCompressedChannel.h"
+
+class PluginSynthesiserSound;
+class PluginSampleData;
 
 class PluginSynthesiserVoice : public juce::SynthesiserVoice
 {
 public:
-    PluginSynthesiserVoice(
-                           juce::RangedAudioParameter& gainParameter,
-                           juce::RangedAudioParameter& panParameter,
-                           juce::AudioParameterBool& phaseParameter
-                           );
+    PluginSynthesiserVoice(PluginSampleStreamer* streamer = nullptr, float floorGain = 0.0f);
     ~PluginSynthesiserVoice() override;
     
     bool canPlaySound(juce::SynthesiserSound*) override;
@@ -20,15 +22,52 @@ public:
     void renderNextBlock(juce::AudioBuffer<float>&, int startSample, int numSamples) override;
     using SynthesiserVoice::renderNextBlock;
     
+    // Voices are pooled, the mic parameters of the sound about to be played are set before each note.
+    void setParameters(juce::RangedAudioParameter& gainParameter, juce::RangedAudioParameter& panParameter, juce::AudioParameterBool& phaseParameter);
+    void fadeOut(float seconds); // tails off over seconds whatever the sound's release
+    bool isReleasing() const noexcept { return mIsReleasing; }
+    
+    bool fillStreamBuffer();
+    
 private:
-    juce::RangedAudioParameter& mGainParameter;
-    juce::RangedAudioParameter& mPanParameter;
-    juce::AudioParameterBool& mInvertPhaseParameter;
+    juce::RangedAudioParameter* mGainParameter = nullptr;
+    juce::RangedAudioParameter* mPanParameter = nullptr;
+    juce::AudioParameterBool* mInvertPhaseParameter = nullptr;
     
+    bool mIsReleasing = false;
+    float mFloorGain; // the voice ends once the rest of its sample stays below it, 0 plays to the end
     double mPitchRatio = 0;
     float mVelocityGain = 0;
+    float mGainLeft = 0; // linear gain, pan, phase and velocity for each output channel
+    float mGainRight = 0;
+    float mTargetGainLeft = 0;
+    float mTargetGainRight = 0;
     double mSourceSamplePosition = 0;
+    int mSourceLength = 0;
+    const PluginSampleData* mResampledData = nullptr; // host rate copy played without interpolation
     juce::ADSR mAdsr;
     
+    // Streaming: the audio thread requests a new stream by bumping mStreamRequestGeneration,
+    // the streamer acknowledges through mStreamReadyGeneration once the ring has been reset.
+    // mStreamWritePosition and mStreamReadPosition are absolute source frames.
+    static constexpr int scratchLength = 2048;
+    static constexpr int renderLength = 256;
+    
+    juce::AudioBuffer<float> mScratchBuffer;
+    juce::AudioBuffer<float> mRenderBuffer; // interpolated left/right frames, left/right gains
+    PluginCompressedChannel::Cursor mDecodeCursors[2]; // last lossless block decoded per channel
+    
+    PluginSampleStreamer* mStreamer;
+    PluginSampleStreamer::StreamSlot* const mStreamSlot; // this voice's ring for its whole life, null without a streamer
+    std::atomic<PluginSynthesiserSound*> mStreamSound { nullptr };
+    std::atomic<int> mStreamRequestGeneration { 0 };
+    std::atomic<int> mStreamReadyGeneration { 0 };
+    std::atomic<juce::int64> mStreamWritePosition { 0 };
+    std::atomic<juce::int64> mStreamReadPosition { 0 };
+    int mStreamerGeneration = 0; // only touched by the streamer thread
+    
+    void updateGainTargets();
+    void fetchFrames(const PluginSynthesiserSound& sound, juce::int64 firstFrame, int numberOfFrames);
+    
     JUCE_LEAK_DETECTOR(PluginSynthesiserVoice)
 };